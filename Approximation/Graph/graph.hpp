@@ -63,6 +63,8 @@
 // 必要なヘッダファイルのインクルード
 //****************************************
 
+#include <cstdint>
+#include <limits>
 #include <vector>
 
 
@@ -20,7 +20,7 @@
 //****************************************
 
 #include "graph.hpp"
-#include <functional>
+#include "../../PriorityQueue/dheap.hpp"
 
 
 
@@ -91,16 +91,19 @@ static inline void initialize_single_source_with_visitor(vertices_t& V, index_t
  *
  * @note   以下のコードは、辺(u, v)上の緩和をΟ(1)時間で実行する
  *         ただし、手続きpred(V, u)がΟ(1)で実行されることを仮定する
+ *         predの型はテンプレート引数なので、std::functionを介さずに呼び出しがインライン展開される
  *
+ * @tparam Predicate       bool(const vertices_t&, index_t)として呼び出せる述語の型
  * @param  vertices_t& V   頂点集合V
  * @param  index_t u       辺(u, v)の始点u (ただし、u ∈ V)
  * @param  index_t v       辺(u, v)の終点v (ただし、v ∈ V)
  * @param  weight_t w      辺(u, v)の重みw
  * @param  Predicate pred  relax可能な前提条件を記述した述語
  */
-static void relax(vertices_t& V,
+template<class Predicate>
+void relax(vertices_t& V,
            index_t u, index_t v, weight_t w,
-           std::function<bool(const vertices_t&, index_t)> pred)
+           Predicate pred)
 {
     if (pred(V, u) && V[v].d > V[u].d + w) {
         V[v].d = V[u].d + w;
@@ -111,26 +114,31 @@ static void relax(vertices_t& V,
 
 // オーバーロードされたrelax関数群
 
-static inline void relax(vertices_t& V, const edge& e,
-           std::function<bool(const vertices_t&, index_t)> pred)
+template<class Predicate>
+inline void relax(vertices_t& V, const edge& e,
+           Predicate pred)
 {
     relax(V, e.src, e.dst, e.w, pred);
 }
-static inline void relax(vertices_t& V, const matrix_t& W,
+template<class Predicate>
+inline void relax(vertices_t& V, const matrix_t& W,
            index_t u, index_t v,
-           std::function<bool(const vertices_t&, index_t)> pred)
+           Predicate pred)
 {
     relax(V, u, v, W[u][v], pred);
 }
 
 
 /**
- * @brief  辺(u, v)を緩和すると同時に、頂点vおよび道s~>vの重みをmin優先度付きキューQに挿入する
- * 
- * @tparam PriorityQueue min優先度付きキューの型
+ * @brief  辺(u, v)を緩和すると同時に、min優先度付きキューQ上の頂点vのキーを道s~>vの重みに更新する
+ *
+ * @note   vが灰色(Qに含まれる)ならばDECREASE-KEYを、白色ならばINSERTを行う. 黒頂点は緩和しないので、
+ *         各頂点は高々1度しかQに含まれず、Qの大きさは高々|V|である
+ *
+ * @tparam PriorityQueue 添字付きmin優先度付きキュー(dheapのように、要素ごとにinsertとdecrease_keyができるもの)の型
  * @param vertices_t&    V 頂点集合V
  * @param const edge&    e 辺(u, v)
- * @param PriorityQueue& Q min優先度付きキュー
+ * @param PriorityQueue& Q 添字付きmin優先度付きキュー
  */
 template<class PriorityQueue>
 void relax_with_heap(vertices_t& V, const edge& e, PriorityQueue& Q)
@@ -139,8 +147,9 @@ void relax_with_heap(vertices_t& V, const edge& e, PriorityQueue& Q)
     if (V[v].color != vcolor::black && V[v].d > V[u].d + e.w) {
         V[v].d     = V[u].d + e.w;
         V[v].pi    = u;
+        if (V[v].color == vcolor::gray) { Q.decrease_key(v, V[v].d); }
+        else                            { Q.insert(v, V[v].d); }
         V[v].color = vcolor::gray;
-        Q.emplace(v, V[v].d);
     }
 }
 
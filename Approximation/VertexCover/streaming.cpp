@@ -0,0 +1,90 @@
+/**
+ * @brief  ストリーミング版とマルチスレッド版の2近似頂点被覆の動作確認
+ *
+ * @note   R-MATグラフの辺リストについて、次のことを確かめる
+ *           1. 反復子から読むstreaming_vertex_coverとファイルから読むstreaming_vertex_coverが一致する
+ *           2. parallel_vertex_coverがstreaming_vertex_coverと(順序を含めて)一致する
+ *           3. 隣接リストの順に並べた辺の列では、streaming_vertex_coverがapprox_vertex_coverと一致する
+ *           4. 得られた集合がすべての辺を被覆する
+ *
+ * @note   使い方 : streaming [scale]  (既定値18)
+ *
+ * @date   2026/10/15
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include "vertex_cover.hpp"
+#include "../../Graph/generator.hpp"
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**
+ * @brief  Cがすべての辺を被覆するか否かを返す
+ */
+bool covers(const edges_t& E, std::size_t n, const indices_t& C)
+{
+    std::vector<std::uint8_t> in(n, 0);
+    for (auto v : C) { in[v] = 1; }
+    for (const auto& e : E) { if (!in[e.src] && !in[e.dst]) { return false; } }
+    return true;
+}
+
+
+
+int main(int argc, char* argv[])
+{
+    using namespace std;
+    using namespace graph;
+    using clock = chrono::steady_clock;
+    auto ms = [](clock::time_point a, clock::time_point b) { return chrono::duration<double, milli>(b - a).count(); };
+
+    std::int32_t scale = argc > 1 ? std::atoi(argv[1]) : 18;
+    std::int32_t n     = 1 << scale;
+    mt19937 mt(1);
+    edges_t E = rmat(scale, 8, mt);  // 無向辺を一方の向きだけで表した辺リストとみなす
+
+    // 辺リストをファイルに書き出す
+    std::FILE* fp = std::tmpfile();
+    for (const auto& e : E) { std::fprintf(fp, "%d %d\n", e.src, e.dst); }
+    std::rewind(fp);
+
+    auto t0 = clock::now();
+    indices_t C1 = streaming_vertex_cover(E.begin(), E.end(), n);
+    auto t1 = clock::now();
+    indices_t C2; bool read = streaming_vertex_cover(fp, C2);
+    auto t2 = clock::now();
+    indices_t C3 = parallel_vertex_cover(E, n);
+    auto t3 = clock::now();
+    std::fclose(fp);
+
+    // 隣接リストの順に並べた辺の列ではapprox_vertex_coverと一致する(自己ループは除く)
+    graph_t G(n);
+    for (const auto& e : E) {
+        if (e.src != e.dst) { G[e.src].emplace_back(e.src, e.dst); G[e.dst].emplace_back(e.dst, e.src); }
+    }
+    edges_t F;
+    for (const auto& adj : G) { F.insert(F.end(), adj.begin(), adj.end()); }
+    bool same = streaming_vertex_cover(F.begin(), F.end(), n) == approx_vertex_cover(G);
+
+    cout << "V = " << n << ", E = " << E.size() << ", |C| = " << C1.size() << endl;
+    cout << "streaming (iterator) " << ms(t0, t1) << " ms" << endl;
+    cout << "streaming (file)     " << ms(t1, t2) << " ms " << (read && C2 == C1 ? "ok" : "NG") << endl;
+    cout << "parallel             " << ms(t2, t3) << " ms " << (C3 == C1 ? "ok" : "NG") << endl;
+    cout << "approx_vertex_cover  " << (same ? "ok" : "NG") << endl;
+    cout << "cover                " << (covers(E, n, C1) ? "ok" : "NG") << endl;
+    return 0;
+}
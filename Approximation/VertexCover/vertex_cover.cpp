@@ -15,69 +15,7 @@
 //****************************************
 
 #include <iostream>
-#include "../../Graph/graph.hpp"
-
-
-
-//****************************************
-// 型シノニム
-//****************************************
-
-using bool_t   = std::int32_t;
-using stamps_t = std::vector<bool_t>;
-
-
-
-//****************************************
-// 名前空間の始点
-//****************************************
-
-GRAPH_BEGIN
-
-
-
-//****************************************
-// 関数の定義
-//****************************************
-
-/**
- * @brief  グラフGから最適頂点被覆を多項式時間で発見する方法は知られていないが、最適に近い頂点被覆は効率よく発見できる
- *         次の近似アルゴリズムは無向グラフGを入力として取り、そのサイズが最適頂点被覆の2倍を超えないことが保証できる頂点被覆を返す
- *
- * @note   APPROX-VERTEX-COVERの計算時間はΟ(V + E)でり、多項式時間2近似アルゴリズムである
- *
- */
-indices_t approx_vertex_cover(const graph_t& G)
-{
-    indices_t C;  // Cを空集合に初期化
-
-    index_t n = G.size();
-    stamps_t visited(n, false);
-
-    // E'から辺(u, v)を取り出し、その両端点uとvをCに付け加え、
-    // uまたはvのどちらかが被覆するすべての辺をE'から削除することを繰り返す
-    for (index_t u = 0; u < n; u++) {
-        if (visited[u]) { continue; }
-        
-        for (auto& e : G[u]) {
-            index_t v = e.dst;
-            if (visited[v]) { continue; }
-
-            C.push_back(u); C.push_back(v);
-            visited[u] = visited[v] = true;
-            break;
-        }
-    }
-    return C;
-}
-
-
-
-//****************************************
-// 名前空間の終点
-//****************************************
-
-GRAPH_END
+#include "vertex_cover.hpp"
 
 
 
@@ -0,0 +1,269 @@
+/**
+ * @brief 頂点被覆問題(vertex-cover problem)の近似アルゴリズムを扱う
+ *
+ * @note  APPROX-VERTEX-COVERが選ぶ辺の集合は極大マッチングであり、その端点の集合が頂点被覆をなす
+ *        極大マッチングは辺を任意の順に1本ずつ見て、両端点がまだ選ばれていなければ選ぶ貪欲法で得られる
+ *        この貪欲法に必要な状態は各頂点が選ばれたか否かの|V|ビットだけなので、グラフ全体をメモリに置く必要はない
+ *          approx_vertex_cover     : 隣接リスト表現graph_tを入力とする逐次版
+ *          streaming_vertex_cover  : 辺の列(反復子の範囲またはテキストの辺リストのファイル)を1回だけ読むストリーミング版
+ *          parallel_vertex_cover   : 決定的予約(deterministic reservations)によるマルチスレッド版(辺リストはメモリ上に置く)
+ *        parallel_vertex_coverは、同じ辺の列を与えたstreaming_vertex_coverとスレッドの数によらず同じ頂点被覆を返す
+ *
+ * @date  2016/03/28
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef __VERTEX_COVER_HPP__
+#define __VERTEX_COVER_HPP__
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <string>
+#include <vector>
+#include "../../Graph/graph.hpp"
+#include "../../Graph/atomic.hpp"
+#include "../../Graph/bitmap.hpp"
+#include "../../Graph/csrfile.hpp"
+
+
+
+//****************************************
+// 型シノニム
+//****************************************
+
+using bool_t   = std::int32_t;
+using stamps_t = std::vector<bool_t>;
+
+
+
+//****************************************
+// 名前空間の始点
+//****************************************
+
+GRAPH_BEGIN
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief  辺を1本ずつ受け取りながら極大マッチングの端点の集合(頂点被覆)を作る
+ *
+ * @note   被覆に加えた頂点の集合をビットマップで持つ. 頂点数が分からない入力にも使えるように、
+ *         ビットマップは現れた最大の頂点番号に合わせて伸ばす. 被覆C以外の状態は|V|ビットである
+ */
+struct vertex_cover_stream {
+    bitmap    visited;  /**< 被覆に加えたか否か */
+    indices_t C;        /**< 頂点被覆 */
+
+    explicit vertex_cover_stream(std::size_t n = 0) : visited(n) {}
+
+    /**
+     * @brief  辺(u, v)を受け取る. uとvがどちらも被覆に含まれなければ、両方を加える(自己ループではuだけを加える)
+     */
+    void insert(index_t u, index_t v)
+    {
+        std::size_t k = std::size_t(u > v ? u : v) + 1;
+        if (visited.size() < k) { grow(k); }
+        if (visited.test(u) || visited.test(v)) { return; }
+        visited.set(u); C.push_back(u);
+        if (u != v) { visited.set(v); C.push_back(v); }
+    }
+
+private:
+    /**< @brief ビットマップを少なくともk要素に伸ばす(償却定数時間になるよう倍々に伸ばす) */
+    void grow(std::size_t k)
+    {
+        bitmap b(std::max(k, 2 * visited.size()));
+        std::copy(visited.words.begin(), visited.words.end(), b.words.begin());
+        visited.swap(b);
+    }
+};
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**
+ * @brief  グラフGから最適頂点被覆を多項式時間で発見する方法は知られていないが、最適に近い頂点被覆は効率よく発見できる
+ *         次の近似アルゴリズムは無向グラフGを入力として取り、そのサイズが最適頂点被覆の2倍を超えないことが保証できる頂点被覆を返す
+ *
+ * @note   APPROX-VERTEX-COVERの計算時間はΟ(V + E)でり、多項式時間2近似アルゴリズムである
+ *
+ */
+inline indices_t approx_vertex_cover(const graph_t& G)
+{
+    indices_t C;  // Cを空集合に初期化
+
+    index_t n = G.size();
+    stamps_t visited(n, false);
+
+    // E'から辺(u, v)を取り出し、その両端点uとvをCに付け加え、
+    // uまたはvのどちらかが被覆するすべての辺をE'から削除することを繰り返す
+    for (index_t u = 0; u < n; u++) {
+        if (visited[u]) { continue; }
+
+        for (auto& e : G[u]) {
+            index_t v = e.dst;
+            if (visited[v]) { continue; }
+
+            C.push_back(u); C.push_back(v);
+            visited[u] = visited[v] = true;
+            break;
+        }
+    }
+    return C;
+}
+
+
+/**
+ * @brief  辺の列[first, last)を1回だけ読んで、2近似の頂点被覆を返す(ストリーミング版)
+ *
+ * @note   各辺(u, v)を受け取った時点でuもvも被覆に含まれていなければ、両方を被覆に加える
+ *         加えた頂点対は互いに素な辺(マッチング)をなし、読み終えた時点ですべての辺が被覆されているので極大マッチングである
+ *         最適頂点被覆はマッチングの各辺の端点を少なくとも1つ含むので、|C| <= 2|C*|である
+ *         実行時間はΘ(E)、被覆以外の記憶量は|V|ビットであり、反復子は前進するだけでよい(入力反復子でもよい)
+ *
+ * @tparam Iterator 辺(edge)を指す反復子
+ * @param  Iterator first 辺の列の先頭
+ * @param  Iterator last  辺の列の終端
+ * @param  std::size_t n  頂点数(分からなければ0でよい)
+ * @return 頂点被覆
+ */
+template <class Iterator>
+indices_t streaming_vertex_cover(Iterator first, Iterator last, std::size_t n = 0)
+{
+    vertex_cover_stream S(n);
+    for (; first != last; ++first) { S.insert(first->src, first->dst); }
+    return S.C;
+}
+
+
+/**
+ * @brief  テキストの辺リスト("u v"または"u v w"の行. csrfile.hppのedgelistreaderが読む形式)から頂点被覆を求める
+ *
+ * @note   ファイルは一定の大きさの緩衝領域を介して先頭から1回だけ読むので、標準入力やパイプでもよく、
+ *         メモリに載らない大きさのグラフも扱える. 無向辺は一方の向きだけが書かれていればよい
+ *
+ * @param  std::FILE* fp 辺リストを読むファイル
+ * @param  indices_t& C  頂点被覆
+ * @return 最後まで読めたか否か(解釈できない行があればfalse)
+ */
+inline bool streaming_vertex_cover(std::FILE* fp, indices_t& C)
+{
+    vertex_cover_stream S;
+    edgelistreader R(fp);
+    edge e; bool hasw;
+    while (R.next(e, hasw)) { S.insert(e.src, e.dst); }
+    C.swap(S.C);
+    return !R.error;
+}
+
+inline bool streaming_vertex_cover(const std::string& path, indices_t& C)
+{
+    std::FILE* fp = std::fopen(path.c_str(), "rb");
+    if (!fp) { return false; }
+    bool ok = streaming_vertex_cover(fp, C);
+    std::fclose(fp);
+    return ok;
+}
+
+
+/**
+ * @brief  決定的予約(deterministic reservations)によるマルチスレッド版の2近似頂点被覆
+ *
+ * @note   辺E[i]の優先度を添字iとし、まだ決着していない辺のうち優先度の高い(添字の小さい)k本を1つの段で処理する
+ *           予約(reserve) : uとvがどちらも被覆に含まれなければ、R[u]とR[v]に不可分なminでiを書き込む
+ *           確定(commit)  : R[u] = R[v] = iならば、uとvを被覆に加える
+ *         どちらかの端点がすでに被覆に含まれる辺は捨て、予約に負けた辺は次の段で先頭から処理し直す
+ *         各段はまだ決着していないすべての辺のうち添字の小さいものから処理するので、辺iが確定するのは、添字がiより小さい辺が
+ *         uとvをどちらも使わないと決着した後である. 従って、結果はEの順に逐次的な貪欲法(streaming_vertex_cover)を行ったものと
+ *         一致し、スレッドの数やスケジュールによらず決定的である
+ *
+ * @note   1つの段で確定できる辺は高々|V| / 2本なので、段の大きさkは|V| / 4(少なくとも1024)とする
+ *         被覆Cは確定した辺を添字の順に並べた端点の列であり、streaming_vertex_coverと同じ順序である
+ *
+ * @param  const edges_t& E 辺の列(無向辺は一方の向きだけでよい)
+ * @param  std::size_t    n 頂点数(すべての端点はn未満でなければならない)
+ * @return 頂点被覆
+ */
+inline indices_t parallel_vertex_cover(const edges_t& E, std::size_t n)
+{
+    using count_t = std::int64_t;
+    const count_t none = std::numeric_limits<count_t>::max();
+    count_t m = E.size(), k = std::max<count_t>(1024, n / 4);
+    std::vector<count_t>      R(n, none);      // 各頂点を予約した辺の添字
+    std::vector<std::uint8_t> visited(n, 0);   // 被覆に加えたか否か
+    std::vector<std::uint8_t> matched(m, 0);   // 確定した辺か否か
+    std::vector<std::uint8_t> keep;            // 次の段に持ち越すか否か
+    std::vector<count_t> prefix, carried;      // 現在の段の辺の添字, 予約に負けて持ち越した辺の添字
+    count_t next = 0;                          // まだ段に入れていない最初の辺
+
+    while (next < m || !carried.empty()) {
+        // 持ち越した辺の後ろに、新しい辺を段の大きさまで加える(持ち越した辺は新しい辺よりすべて添字が小さい)
+        prefix.swap(carried); carried.clear();
+        while (count_t(prefix.size()) < k && next < m) { prefix.push_back(next++); }
+        count_t p = prefix.size();
+        keep.assign(p, 0);
+
+        // 予約
+#pragma omp parallel for
+        for (count_t j = 0; j < p; j++) {
+            count_t i = prefix[j]; index_t u = E[i].src, v = E[i].dst;
+            if (visited[u] || visited[v]) { continue; }  // すでに被覆されている
+            write_min(&R[u], i); write_min(&R[v], i);
+            keep[j] = 1;
+        }
+        // 確定
+#pragma omp parallel for
+        for (count_t j = 0; j < p; j++) {
+            if (!keep[j]) { continue; }
+            count_t i = prefix[j]; index_t u = E[i].src, v = E[i].dst;
+            if (R[u] == i && R[v] == i) { visited[u] = visited[v] = 1; matched[i] = 1; keep[j] = 0; }
+        }
+        // 予約を消し、負けた辺を添字の順に持ち越す(端点を共有する辺が同じ要素に書き込むので、不可分に書き込む)
+#pragma omp parallel for
+        for (count_t j = 0; j < p; j++) {
+            count_t i = prefix[j];
+            atomic_store(&R[E[i].src], none); atomic_store(&R[E[i].dst], none);
+        }
+        for (count_t j = 0; j < p; j++) { if (keep[j]) { carried.push_back(prefix[j]); } }
+    }
+
+    indices_t C;
+    for (count_t i = 0; i < m; i++) {
+        if (!matched[i]) { continue; }
+        C.push_back(E[i].src);
+        if (E[i].src != E[i].dst) { C.push_back(E[i].dst); }
+    }
+    return C;
+}
+
+
+
+//****************************************
+// 名前空間の終点
+//****************************************
+
+GRAPH_END
+
+
+
+#endif  // end of __VERTEX_COVER_HPP__
@@ -19,12 +19,19 @@
 // 必要なヘッダファイルのインクルード
 //****************************************
 
+#include <algorithm>
 #include "../Graph/graph.hpp"
+#include "../Graph/atomic.hpp"
+#include "../Graph/bitmap.hpp"
+#include "../Graph/bitmatrix.hpp"
+#include "../Graph/vertexstate.hpp"
+#include "../Graph/visitor.hpp"
+#include "../Queue/queue.hpp"
 
 
 
 //****************************************
-// 関数の宣言
+// 関数の宣言および定義
 //****************************************
 
 /**
@@ -51,11 +58,296 @@
  *
  * @note   BFSの総実行時間はΟ(V+E)である.したがって、幅優先探索はGの隣接リスト表現のサイズの線形時間で走る
  *
- * @param  const graph_t& G  グラフG
- * @param  std::int32_t s  始点s
+ * @note   頂点の属性は属性ごとの配列からなるvertexstateに書き込む(Graph/vertexstate.hpp). 辺の走査が読むのは色の配列(1頂点1バイト)だけである
+ *         探索の各事象で訪問者visの同名のメンバ関数を呼び出す(Graph/visitor.hpp)
+ *
+ * @tparam Graph   グラフの表現(graph_tまたはcsrgraph. G.size()とG[u]による隣接リストの走査ができればよい)
+ * @tparam Visitor 訪問者の型(nullvisitorを継承したもの)
+ * @param  const Graph&  G   グラフG
+ * @param  std::int32_t  s   始点s
+ * @param  vertexstate&  S   幅優先木(初期化して上書きする)
+ * @param  Visitor&&     vis 訪問者
+ */
+template <class Graph, class Visitor>
+void bfs(const Graph& G, index_t s, vertexstate& S, Visitor&& vis)
+{
+    std::int32_t n = G.size();
+
+    S.reset(n);                        // すべての頂点uについて、uを白に彩色し、u.dを無限大に設定し、uの親をNILに設定する
+    for (index_t u = 0; u < n; u++) { vis.initialize_vertex(u); }
+    // 手続き開始と同時に始点sを発見すると考え、
+    S.paint(s, color::gray);        // 始点sを灰色に彩色する 
+    S.d[s]  = 0;                    // s.dを0に初期化し、
+    S.pi[s] = graph::nil;           // 始点の先行点をNILに設定する
+    vis.discover_vertex(s);
+
+    queue<index_t> Q(n);
+    Q.enqueue(s);                   // sだけを含むようにQを初期化する
+
+    // 以下のwhile文に対して、つぎのループ不変式が成立する
+    // while文の条件判定を行う時点ではキューQはすべての灰頂点を含む
+    while (!Q.empty()) {
+        index_t u = Q.dequeue();
+        weight_t du = S.d[u];
+        vis.examine_vertex(u);
+        for (const auto& e : G[u]) {             // uの隣接リストに
+            index_t v = e.dst;                   // 属する各頂点vを考える
+            vis.examine_edge(e);
+            if (S.colorof(v) == color::white) {  // vが白ならvは未発見である
+                vis.tree_edge(e);
+                S.paint(v, color::gray);         // vを灰色に彩色し、
+                S.d[v]  = du + 1;                // 距離v.dをu.d+1に設定し、
+                S.pi[v] = u;                     // uをその親v.piとして記録し、
+                vis.discover_vertex(v);
+                Q.enqueue(v);                    // vをキューQの末尾に置く
+            }
+            else {
+                vis.non_tree_edge(e);
+            }
+        }
+        S.paint(u, color::black);  // uの隣接リストに属するすべての頂点の探索が完了すると、この頂点を黒に彩色する
+        vis.finish_vertex(u);
+    }
+    // ある頂点を灰に彩色したときには、この頂点をQへ挿入し、ある頂点をQから削除したときには、この頂点を黒に彩色するので、
+    // ループ不変式が保存される
+}
+
+
+/**
+ * @brief  幅優先探索を行います(頂点の状態に書き込み、事象を受け取らない)
+ */
+template <class Graph>
+void bfs(const Graph& G, index_t s, vertexstate& S)
+{
+    bfs(G, s, S, nullvisitor());
+}
+
+
+/**
+ * @brief  幅優先探索を行います(幅優先木を頂点集合として返す)
+ */
+template <class Graph, class Visitor>
+vertices_t bfs(const Graph& G, index_t s, Visitor&& vis)
+{
+    vertexstate S;
+    bfs(G, s, S, vis);
+    return S.tovertices();
+}
+
+
+/**
+ * @brief  幅優先探索を行います(幅優先木を頂点集合として返し、事象を受け取らない)
+ */
+template <class Graph>
+vertices_t bfs(const Graph& G, index_t s)
+{
+    return bfs(G, s, nullvisitor());
+}
+
+
+
+/**
+ * @brief  方向最適化(direction-optimizing)を行うマルチスレッド版幅優先探索
+ *
+ * @note   幅優先探索の各レベルでは、フロンティア(距離kの頂点集合)から距離k+1の頂点集合を求める. その方法は2通りある
+ *
+ *         * トップダウン(top-down) : フロンティアの各頂点uについてAdj[u]を走査し、未発見の頂点vを発見する
+ *                                    調べる辺の数はフロンティアから出る辺の数mfである
+ *         * ボトムアップ(bottom-up) : 未発見の各頂点vについて入辺を走査し、フロンティアに属する親uを1つ見つけたら走査を打ち切る
+ *                                    調べる辺の数は高々未発見の頂点に入る辺の数muであり、親が見つかればそれより少ない
+ *
+ *         直径の小さいグラフでは、数レベルのうちにフロンティアが頂点の大半を含むようになる. このときmfは巨大になるが、
+ *         未発見の頂点の多くはすぐに親を見つけるので、ボトムアップのほうが調べる辺ははるかに少ない
+ *         逆に、探索の始めと終わりのフロンティアが小さいレベルではトップダウンのほうが有利である
+ *         そこで、レベルごとに次の規則で方向を切り替える
+ *           トップダウン -> ボトムアップ : mf > mu / alpha
+ *           ボトムアップ -> トップダウン : nf < |V| / beta  (nfはフロンティアの頂点数)
+ *
+ * @note   トップダウンではフロンティアを頂点の添字の配列(疎な表現)として持ち、複数のストランドが同じ頂点vを
+ *         同時に発見しうるので、v.πの設定を比較交換(CAS)で行って勝者を1つに決める
+ *         ボトムアップではフロンティアをビットマップとして持ち、各ストランドは64頂点(1語)単位で未発見の頂点を受け持つ
+ *         頂点vを更新するのはvを受け持つストランドだけなので、不可分操作は必要ない
+ *
+ * @note   得られる距離v.dは逐次版BFSと一致する. 先行点v.πは同じ距離の別の頂点になることがあるが、幅優先木であることに変わりはない
+ *         OpenMPを無効にしてコンパイルした場合は逐次に実行される
+ *
+ * @tparam Graph グラフの表現(graph_tまたはcsrgraph)
+ * @param  const Graph& G     グラフG
+ * @param  const Graph& GT    Gの転置G^T(ボトムアップで入辺を走査するために用いる)
+ * @param  index_t      s     始点s
+ * @param  std::int32_t alpha トップダウンからボトムアップへ切り替える閾値
+ * @param  std::int32_t beta  ボトムアップからトップダウンへ切り替える閾値
  * @return 幅優先木
  */
-vertices_t bfs(const graph_t& G, index_t s);
+template <class Graph>
+vertices_t dobfs(const Graph& G, const Graph& GT, index_t s,
+                 std::int32_t alpha = 14, std::int32_t beta = 24)
+{
+    using count_t = std::int64_t;
+    std::int32_t n = G.size();
+    indices_t pi(n, graph::nil);  // 先行点(探索中、始点sの先行点はs自身とし、pi[v] != NILを発見済みの印とする)
+    array_t   d(n, graph::inf);   // 始点sからの距離
+    indices_t front(n), next(n);  // 疎な表現のフロンティア
+    bitmap    fbits(n), nbits(n); // ビットマップ表現のフロンティア
+    count_t   nf = 0, mf = 0, mu = 0;
+
+#pragma omp parallel for reduction(+:mu)
+    for (index_t u = 0; u < n; u++) { mu += G[u].size(); }
+
+    pi[s] = s; d[s] = 0;                 // 手続き開始と同時に始点sを発見すると考え、
+    front[nf++] = s;                     // sだけを含むようにフロンティアを初期化する
+    mf = G[s].size(); mu -= mf;
+    bool bottomup = false;
+
+    // トップダウンの1ステップ : フロンティアの各頂点から出る辺を調べ、未発見の頂点をnextに集める
+    auto topdown_step = [&](weight_t k) {
+        count_t tail = 0, m = 0;
+#pragma omp parallel reduction(+:m)
+        {
+            indices_t local;
+#pragma omp for schedule(dynamic, 64) nowait
+            for (count_t i = 0; i < nf; i++) {
+                index_t u = front[i];
+                for (const auto& e : G[u]) {
+                    index_t v = e.dst;
+                    if (atomic_load(&pi[v]) == graph::nil && cas(&pi[v], index_t(graph::nil), u)) {
+                        d[v] = k + 1; local.push_back(v); m += G[v].size();
+                    }
+                }
+            }
+            count_t i = fetch_add(&tail, count_t(local.size()));  // nextの中に自分の区画を確保し、
+            std::copy(local.begin(), local.end(), next.begin() + i);  // 発見した頂点を書き込む
+        }
+        front.swap(next); nf = tail; mf = m;
+    };
+    // ボトムアップの1ステップ : 未発見の各頂点について、フロンティアに属する親を探す
+    auto bottomup_step = [&](weight_t k) {
+        count_t awake = 0, m = 0;
+        count_t words = fbits.words.size();
+        nbits.clear();
+#pragma omp parallel for schedule(dynamic, 16) reduction(+:awake, m)
+        for (count_t w = 0; w < words; w++) {
+            index_t last = std::min<count_t>(n, (w + 1) * bitmap::bits);
+            for (index_t v = w * bitmap::bits; v < last; v++) {
+                if (pi[v] != graph::nil) { continue; }
+                for (const auto& e : GT[v]) {
+                    index_t u = e.dst;              // 転置グラフの辺(v, u)は元のグラフの辺(u, v)である
+                    if (fbits.test(u)) {            // uがフロンティアに属するならば、
+                        pi[v] = u; d[v] = k + 1;    // uをvの親とし、
+                        nbits.set(v);               // vを次のフロンティアに加えて、
+                        awake++; m += G[v].size();
+                        break;                      // 残りの入辺は調べない
+                    }
+                }
+            }
+        }
+        fbits.swap(nbits); nf = awake; mf = m;
+    };
+    // 疎な表現からビットマップ表現へ変換する
+    auto tobitmap = [&]() {
+        fbits.clear();
+#pragma omp parallel for
+        for (count_t i = 0; i < nf; i++) { fbits.atomic_set(front[i]); }
+    };
+    // ビットマップ表現から疎な表現へ変換する
+    auto tosparse = [&]() {
+        count_t tail = 0, words = fbits.words.size();
+#pragma omp parallel
+        {
+            indices_t local;
+#pragma omp for nowait
+            for (count_t w = 0; w < words; w++) {
+                for (bitmap::word_t x = fbits.words[w]; x != 0; x &= x - 1) {
+                    local.push_back(w * bitmap::bits + __builtin_ctzll(x));
+                }
+            }
+            count_t i = fetch_add(&tail, count_t(local.size()));
+            std::copy(local.begin(), local.end(), front.begin() + i);
+        }
+        nf = tail;
+    };
+
+
+    for (weight_t k = 0; nf > 0; k++) {
+        if (!bottomup && mf > mu / alpha) {     // フロンティアから出る辺が多ければ、
+            tobitmap(); bottomup = true;        // ボトムアップに切り替える
+        }
+        else if (bottomup && nf < n / beta) {   // フロンティアが十分小さくなれば、
+            tosparse(); bottomup = false;       // トップダウンに戻す
+        }
+        if (bottomup) { bottomup_step(k); }
+        else          { topdown_step(k); }
+        mu -= mf;  // 新たに発見した頂点から出る辺は未探索ではなくなる
+    }
+
+
+    vertices_t V(n);
+#pragma omp parallel for
+    for (index_t v = 0; v < n; v++) {
+        V[v].d     = d[v];
+        V[v].pi    = (v == s) ? index_t(graph::nil) : pi[v];
+        V[v].color = (pi[v] != graph::nil) ? color::black : color::white;
+    }
+    return V;
+}
+
+
+/**
+ * @brief  方向最適化を行うマルチスレッド版幅優先探索
+ * @note   無向グラフ(隣接リストが対称なグラフ)ではG^T = Gなので、転置グラフを与える必要がない
+ */
+template <class Graph>
+vertices_t dobfs(const Graph& G, index_t s)
+{
+    return dobfs(G, G, s);
+}
+
+
+/**
+ * @brief  ビット行列で表現した重みなしグラフ上の幅優先探索
+ *
+ * @note   フロンティアの各頂点uについて、Aのu行と訪問済みの頂点集合の補集合との論理積を語単位で取れば、
+ *         uが新たに発見する頂点が64頂点ずつまとめて得られる. 新たに発見した頂点はただちに訪問済みの集合に加えるので、
+ *         各頂点の親はそれを最初に発見したフロンティアの頂点になる(逐次版BFSと同じ幅優先木が得られる)
+ *
+ * @note   各頂点はフロンティアに高々1度しか入らないので、実行時間はΘ(V^2 / 64)である
+ *         密なグラフでは隣接リストを走査するΘ(V + E)時間のbfsより速く、記憶量も隣接リストより小さい
+ *
+ * @param  const bitmatrix& A 隣接行列A
+ * @param  index_t          s 始点s
+ * @return 幅優先木
+ */
+inline vertices_t bfs(const bitmatrix& A, index_t s)
+{
+    using word_t = bitmatrix::word_t;
+    std::int32_t n = A.size();
+    vertices_t V(n);
+    for (auto& u : V) { u.color = color::white; u.d = graph::inf; u.pi = graph::nil; }
+    V[s].color = color::gray; V[s].d = 0;
+
+    bitmap    visited(n);
+    indices_t front{ s }, next;
+    visited.set(s);
+    for (weight_t k = 0; !front.empty(); k++) {
+        next.clear();
+        for (index_t u : front) {
+            const word_t* r = A.row(u);
+            for (std::size_t w = 0; w < A.stride; w++) {
+                word_t x = r[w] & ~visited.words[w];  // uが新たに発見する頂点
+                if (x == 0) { continue; }
+                visited.words[w] |= x;
+                for (; x != 0; x &= x - 1) {
+                    index_t v = index_t(w * bitmatrix::bits + __builtin_ctzll(x));
+                    V[v].color = color::gray; V[v].d = k + 1; V[v].pi = u;
+                    next.push_back(v);
+                }
+            }
+            V[u].color = color::black;
+        }
+        front.swap(next);
+    }
+    return V;
+}
 
 
 
@@ -0,0 +1,81 @@
+/**
+ * @brief  ビット並列の多始点幅優先探索の動作確認
+ *
+ * @note   R-MATグラフ(無向)上で、始点ごとのbfsとmsbfs<64>, msbfs<256>の距離が一致することを確かめ、実行時間を比べる
+ *         求めた距離から近接中心性(到達できる頂点への距離の和の逆数を、到達できる頂点の数で正規化したもの)を計算する
+ *
+ * @date   2026/10/15
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include "bfs.hpp"
+#include "msbfs.hpp"
+#include "../Graph/csr.hpp"
+#include "../Graph/generator.hpp"
+
+
+
+int main(int argc, char* argv[])
+{
+    using namespace std;
+    std::int32_t scale = argc > 1 ? std::atoi(argv[1]) : 14;
+    std::int32_t k     = argc > 2 ? std::atoi(argv[2]) : 1024;  // 始点の数
+    std::int32_t n     = 1 << scale;
+    mt19937 mt(1);
+    csrgraph G(n, symmetrize(rmat(scale, 8, mt)));
+    indices_t sources(k);
+    for (auto& s : sources) { s = uniformindex(mt, n); }
+
+    // 始点ごとのbfs
+    vector<array_t> D(k, array_t(n));
+    auto t0 = chrono::steady_clock::now();
+    for (std::int32_t i = 0; i < k; i++) {
+        vertexstate S;
+        bfs(G, sources[i], S);
+        D[i] = S.d;
+    }
+    auto t1 = chrono::steady_clock::now();
+
+    // 始点から行の位置を引けるように、始点ごとの結果の位置を記録する(始点は重複しうるので、最後の位置で代表させる)
+    indices_t at(n, graph::nil);
+    for (std::int32_t i = 0; i < k; i++) { at[sources[i]] = i; }
+    auto run = [&](auto tag) -> pair<double, bool> {
+        constexpr std::size_t W = decltype(tag)::value;
+        bool ok = true; std::int64_t rows = 0;
+        auto start = chrono::steady_clock::now();
+        msbfs<W>(G, sources, [&](index_t s, const array_t& row) {
+            bool same = row == D[at[s]];
+#pragma omp critical
+            { ok = ok && same; rows++; }
+        });
+        auto stop = chrono::steady_clock::now();
+        return make_pair(chrono::duration<double, milli>(stop - start).count(), ok && rows == k);
+    };
+    auto r64  = run(integral_constant<std::size_t, 64>());
+    auto r256 = run(integral_constant<std::size_t, 256>());
+
+    cout << "V = " << n << ", E = " << G.edges() << ", sources = " << k << endl;
+    cout << "bfs        " << chrono::duration<double, milli>(t1 - t0).count() << " ms" << endl;
+    cout << "msbfs<64>  " << r64.first  << " ms " << (r64.second  ? "ok" : "NG") << endl;
+    cout << "msbfs<256> " << r256.first << " ms " << (r256.second ? "ok" : "NG") << endl;
+
+    // 近接中心性の上位の頂点
+    std::int32_t best = 0; double cbest = 0;
+    for (std::int32_t i = 0; i < k; i++) {
+        std::int64_t sum = 0, reach = 0;
+        for (auto d : D[i]) { if (d != graph::inf && d > 0) { sum += d; reach++; } }
+        double c = sum > 0 ? double(reach) * reach / (double(n - 1) * sum) : 0;
+        if (c > cbest) { cbest = c; best = i; }
+    }
+    cout << "max closeness " << cbest << " at vertex " << sources[best] << endl;
+    return 0;
+}
@@ -0,0 +1,138 @@
+/**
+ * @brief  複数の始点からの幅優先探索を1回の走査で同時に行うビット並列の多始点幅優先探索(multi-source BFS)を扱う
+ *
+ * @note   近接中心性や全点対のホップ数の行列を求めるために始点ごとにbfsを呼び出すと、始点の数だけ隣接リストを読み直す
+ *         多始点幅優先探索(Then et al., MS-BFS)は、W個の始点の探索を1頂点あたりWビットの集合で表し、
+ *         各段で頂点uの隣接リストを1度だけ読んで、uを同じ段に含むすべての始点の探索をまとめて進める
+ *         小世界性を持つグラフでは多くの始点の探索が同じ段で同じ頂点に達するので、辺の走査の回数がほぼ1/Wになる
+ *
+ * @date   2026/10/15
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef __MSBFS_HPP__
+#define __MSBFS_HPP__
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "../Graph/graph.hpp"
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**
+ * @brief  ビット並列の多始点幅優先探索
+ *
+ * @note   始点の列をW個ずつのバッチに分け、バッチのi番目の始点の探索を各頂点のビット集合の第iビットで表す
+ *         各頂点vは、Wビットの集合を3つ持つ
+ *           seen[v]  : vをすでに発見した探索の集合
+ *           visit[v] : 現在の段でvをフロンティアに含む探索の集合
+ *           next[v]  : 次の段でvをフロンティアに含む探索の集合
+ *         第k段では、visit[u]が空でない各頂点uについて、uの隣接リストを1度だけ走査して各辺(u, v)でnext[v] |= visit[u]とする
+ *         次に、next[v] &= ~seen[v], seen[v] |= next[v]とし、next[v]の第iビットが立っていればi番目の始点からvへの距離はkである
+ *         集合の演算は64ビット語W / 64個ずつで行う. visitが空でない頂点とnextを更新した頂点はリストで持つので、
+ *         各段の仕事量はフロンティアの頂点の隣接リストの長さの和に比例する(Θ(V)の全頂点の走査は行わない)
+ *
+ * @note   バッチごとの探索は互いに独立なので、OpenMPのスレッドに動的に割り当てる. 各スレッドはビット集合の作業領域(3 * V * W / 8バイト)と
+ *         距離の行(W * V * 4バイト)を1つずつ確保し、すべてのバッチで使い回す. 例えば|V| = 2^20, W = 256では、1スレッドあたり約1.1GiBである
+ *         Wが大きいほど辺の走査は共有されるが、作業領域は大きくなり、各段のビット演算も増える
+ *
+ * @note   コールバックf(s, row)は始点sのバッチの探索を終えるたびに、それを実行したスレッドから呼び出される
+ *         row[v]は始点sから頂点vへの辺の数(到達できなければ∞)であり、rowはfから戻った後に次のバッチで上書きされる
+ *         johnsonと同じく、fは複数のスレッドから同時に、始点の順とは限らない順に呼び出されうる
+ *
+ * @tparam W       1バッチの始点の数(64の倍数. 64または256を想定する)
+ * @tparam Graph   グラフの表現(graph_tまたはcsrgraph)
+ * @tparam Visitor void(index_t, const array_t&)として呼び出せる関数オブジェクト
+ * @param  const Graph&     G       グラフG(辺の重みは無視する)
+ * @param  const indices_t& sources 始点の列(重複していてもよい)
+ * @param  Visitor          f       距離の1行を受け取るコールバック
+ */
+template <std::size_t W = 64, class Graph, class Visitor>
+void msbfs(const Graph& G, const indices_t& sources, Visitor f)
+{
+    static_assert(W > 0 && W % 64 == 0, "W must be a positive multiple of 64");
+    using word_t = std::uint64_t;
+    const std::size_t K = W / 64;  // 1頂点あたりの語数
+    std::int32_t n = G.size();
+    std::int64_t batches = (std::int64_t(sources.size()) + W - 1) / W;
+
+    auto empty = [K](const word_t* x) { for (std::size_t j = 0; j < K; j++) { if (x[j]) { return false; } } return true; };
+
+#pragma omp parallel
+    {
+        std::vector<word_t>  seen(n * K, 0), visit(n * K, 0), next(n * K, 0);  // スレッドごとの作業領域
+        std::vector<array_t> rows(W, array_t(n, graph::inf));
+        indices_t frontier, touched, following;
+
+#pragma omp for schedule(dynamic, 1)
+        for (std::int64_t b = 0; b < batches; b++) {
+            std::size_t first = b * W, k = std::min(sources.size() - first, W);
+
+            // 各始点sについて、seen[s]とvisit[s]のビットを立てる
+            frontier.clear();
+            for (std::size_t i = 0; i < k; i++) {
+                index_t s = sources[first + i];
+                word_t bit = word_t(1) << (i % 64);
+                if (empty(&visit[s * K])) { frontier.push_back(s); }
+                seen[s * K + i / 64] |= bit; visit[s * K + i / 64] |= bit;
+                rows[i][s] = 0;
+            }
+
+            for (weight_t level = 1; !frontier.empty(); level++) {
+                // フロンティアの各頂点uの隣接リストを1度だけ走査し、uを含む探索をまとめて隣接頂点に進める
+                touched.clear();
+                for (index_t u : frontier) {
+                    const word_t* x = &visit[u * K];
+                    for (const auto& e : G[u]) {
+                        word_t* y = &next[e.dst * K];
+                        if (empty(y)) { touched.push_back(e.dst); }
+                        for (std::size_t j = 0; j < K; j++) { y[j] |= x[j]; }
+                    }
+                }
+                for (index_t u : frontier) { std::fill_n(&visit[u * K], K, word_t(0)); }
+
+                // 初めて発見した探索だけを残し、その始点からの距離を記録する
+                following.clear();
+                for (index_t v : touched) {
+                    word_t* y = &next[v * K]; word_t* z = &seen[v * K];
+                    bool found = false;
+                    for (std::size_t j = 0; j < K; j++) {
+                        y[j] &= ~z[j]; z[j] |= y[j]; found = found || y[j];
+                        for (word_t w = y[j]; w != 0; w &= w - 1) { rows[j * 64 + __builtin_ctzll(w)][v] = level; }
+                    }
+                    if (found) { following.push_back(v); }
+                }
+                visit.swap(next);  // 旧visitはフロンティアの頂点を消したので、すべて0である
+                frontier.swap(following);
+            }
+
+            // 距離の行を渡し、次のバッチのために作業領域を戻す
+            for (std::size_t i = 0; i < k; i++) {
+                f(sources[first + i], static_cast<const array_t&>(rows[i]));
+                std::fill(rows[i].begin(), rows[i].end(), weight_t(graph::inf));
+            }
+            std::fill(seen.begin(), seen.end(), word_t(0));
+        }
+    }
+}
+
+
+
+#endif  // end of __MSBFS_HPP__
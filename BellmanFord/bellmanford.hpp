@@ -19,14 +19,41 @@
 // 必要なヘッダファイルのインクルード
 //****************************************
 
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
 #include "../Graph/graph.hpp"
+#include "../Graph/atomic.hpp"
+#include "../Graph/visitor.hpp"
+#include "../Queue/queue.hpp"
 
 
 
 //****************************************
-// 関数プロトタイプ
+// 型の定義
 //****************************************
 
+/**
+ * @brief  Bellman-Fordアルゴリズムの緩和の進め方
+ * @note   passes   : すべての辺を繰り返し走査する(ある走査で推定値が変化しなければ、そこで打ち切る)
+ *         worklist : 推定値が減少した頂点だけをFIFOキューに入れ、そこから出る辺だけを緩和する(SPFA)
+ *         parallel : 前の段で推定値が減少した頂点から出る辺を、段ごとに不可分なminによって並列に緩和する
+ */
+enum struct bfmode { passes, worklist, parallel };
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+template <class Graph>
+std::pair<bool, vertices_t> spfa(const Graph& G, index_t s);
+template <class Graph>
+std::pair<bool, vertices_t> parallelbellmanford(const Graph& G, index_t s);
+
+
 /**
  * @brief  Bellman-Fordアルゴリズム
  *
@@ -39,10 +66,230 @@
  *         実際の最短路重みδ(s, v)に一致するまで徐々に減らす
  *         アルゴリズムが値TRUEを返すのは、グラフの始点から到達可能な負閉路を含まないとき、かつそのときに限る
  *
- * @param  const graph_t& G グラフG
- * @param  index_t        s 始点s
+ * @note   Bellman-FordアルゴリズムはΟ(VE)時間で走る
+ *         ただし、ある走査で1つも推定値が変化しなければ、以降の走査でも変化しないので、そこで打ち切る
+ *
+ * @note   各辺の吟味と緩和の事象で訪問者visの同名のメンバ関数を呼び出す(Graph/visitor.hpp)
+ *
+ * @tparam Graph   グラフの表現(graph_tまたはcsrgraph)
+ * @tparam Visitor 訪問者の型(nullvisitorを継承したもの)
+ * @param  const Graph&   G    グラフG
+ * @param  index_t        s    始点s
+ * @param  Visitor&&      vis  訪問者
  */
-std::pair<bool, vertices_t> bellmanford(const graph_t& G, index_t s);
+template <class Graph, class Visitor>
+std::pair<bool, vertices_t> bellmanford(const Graph& G, index_t s, Visitor&& vis)
+{   
+    std::int32_t n = G.size();
+    vertices_t V(n);
+
+    // Θ(V)の手続きによって最短路推定値と先行点を初期化する
+    auto initsinglesource = [&vis](vertices_t& V, index_t s, std::int32_t n) -> void {
+        for (std::int32_t i = 0; i < n; i++) { V[i].d  = graph::inf; V[i].pi = graph::nil; vis.initialize_vertex(i); }
+        V[s].d = 0;
+    };
+    // 辺(u, v)の緩和(relaxing)はuを経由することでvへの既知の最短路が改善できるか否か判定し、改善できるならばv.dとv.πを更新する
+    // 緩和によって最短路推定値v.dが減少し、vの先行点属性v.πが更新されることがある. 以下のコードは、辺(u, v)上の緩和をΟ(1)時間で実行する
+    auto relax = [&vis](const edge& e, vertices_t& V) -> bool {
+        index_t v = e.dst, u = e.src;
+        vis.examine_edge(e);
+        if (V[u].d != graph::inf && V[v].d > V[u].d + e.w) { V[v].d = V[u].d + e.w; V[v].pi = u; vis.edge_relaxed(e); return true; }
+        vis.edge_not_relaxed(e);
+        return false;
+    };
+
+    
+    initsinglesource(V, s, n);  // すべての頂点のd値とπ値を初期化する
+    // アルゴリズムはグラフのすべての辺を|V| - 1回走査する
+    for (std::int32_t i = 0; i < n - 1; i++) {
+        bool changed = false;
+        for (index_t u = 0; u < n; u++) { for (const auto& e : G[u]) {
+                changed = relax(e, V) || changed;  // グラフの各辺をそれぞれ1回緩和する
+            }
+        }
+        if (!changed) { return std::make_pair(true, V); }  // 推定値が収束した
+    }
+    // Gがsから到達可能な負閉路を含まなければ、終了時に、すべての辺(u, v)に対して、
+    //   u.d = δ(s, v)
+    //      <= δ(s, u) + w(u, v) (∵ 三角不等式)
+    //       = u.d + w(u, v)
+    // だから、BELLMAN-FORDは値FALSEを返すことはなく、TRUEを返す
+    for (index_t i = 0; i < n; i++) { for (const auto& e : G[i]) {  // 負の重みを持つ閉路の有無を判定する
+            index_t v = e.dst, u = e.src;
+            if (V[u].d != graph::inf && V[v].d > V[u].d + e.w) {  // Gが始点sから到達可能な負閉路を含むとき、
+                return std::make_pair(false, V);       // FALSEを返す
+            }
+        }
+    }
+    // Gがsから到達可能な負閉路を含まなければ、値TRUEを返し、すべての頂点v ∈ Vに対してδ(s, v)が成り立ち、
+    // 先行点部分グラフGπはsを根とする最短路木である
+    return std::make_pair(true, V);
+}
+
+
+/**
+ * @brief  Bellman-Fordアルゴリズム(事象を受け取らない)
+ *
+ * @note   modeがpassesならば、すべての辺を走査する上の版をnullvisitorで呼び出す
+ *         (訪問者を受け取る版とは、第3引数の型が異なるので多重定義で区別される)
+ *
+ * @tparam Graph グラフの表現(graph_tまたはcsrgraph)
+ * @param  const Graph&   G    グラフG
+ * @param  index_t        s    始点s
+ * @param  bfmode         mode 緩和の進め方(worklistはspfaを、parallelはparallelbellmanfordを呼び出す)
+ */
+template <class Graph>
+std::pair<bool, vertices_t> bellmanford(const Graph& G, index_t s, bfmode mode = bfmode::passes)
+{
+    if (mode == bfmode::worklist) { return spfa(G, s); }
+    if (mode == bfmode::parallel) { return parallelbellmanford(G, s); }
+    return bellmanford(G, s, nullvisitor());
+}
+
+
+
+/**
+ * @brief  推定値が減少した頂点だけを処理するBellman-Fordアルゴリズム(SPFA)
+ *
+ * @note   辺(u, v)の緩和がv.dを変えうるのは、前回(u, v)を緩和してからu.dが減少した場合だけである
+ *         そこで、推定値が減少した頂点をFIFOキューQに入れ(すでにQにあれば入れない)、Qから取り出した頂点から出る辺だけを緩和する
+ *         Qが空になった時点で、すべての辺について三角不等式が成り立つので、|V| - 1回の走査を待たずに終了できる
+ *
+ * @note   各頂点vについて、v.πを辿ったsからの道の辺数v.lenを保持する. 負閉路がなければ最短路は高々|V| - 1辺なので、
+ *         v.len >= |V|となった時点で、sから到達可能な負閉路が存在すると判定する
+ *         最悪の場合の実行時間はΟ(VE)のままだが、負辺の少ない疎なグラフでは多くの場合Ο(E)に近い
+ */
+template <class Graph>
+std::pair<bool, vertices_t> spfa(const Graph& G, index_t s)
+{
+    std::int32_t n = G.size();
+    vertices_t V(n);
+    indices_t len(n, 0);
+    std::vector<bool> inqueue(n, false);
+    queue<index_t> Q(n);
+
+    for (auto& v : V) { v.d = graph::inf; v.pi = graph::nil; }
+    V[s].d = 0;
+    Q.enqueue(s); inqueue[s] = true;
+    while (!Q.empty()) {
+        index_t u = Q.dequeue(); inqueue[u] = false;
+        for (const auto& e : G[u]) {
+            index_t v = e.dst;
+            if (V[v].d > V[u].d + e.w) {
+                V[v].d = V[u].d + e.w; V[v].pi = u; len[v] = len[u] + 1;
+                if (len[v] >= n) { return std::make_pair(false, V); }  // 最短路が|V|辺以上になった
+                if (!inqueue[v]) { Q.enqueue(v); inqueue[v] = true; }
+            }
+        }
+    }
+    return std::make_pair(true, V);
+}
+
+
+/**
+ * @brief  辺の緩和をマルチスレッド化したBellman-Fordアルゴリズム
+ *
+ * @note   第k段では、第k - 1段で推定値が減少した頂点(第0段は始点sだけ)から出る辺を並列に緩和する
+ *         各頂点の(推定値, 先行点)を1語に詰め込み、推定値だけを比べる不可分なminで更新するので、
+ *         同じ頂点への緩和が競合しても推定値と先行点が食い違うことはない
+ *         第k段を終えた時点で、各頂点の推定値は辺数k以下の最短路重み以下である. 従って、負閉路がなければ
+ *         高々|V| - 1段で推定値は変化しなくなり、第|V|段でも推定値が減少すれば負閉路が存在する
+ */
+template <class Graph>
+std::pair<bool, vertices_t> parallelbellmanford(const Graph& G, index_t s)
+{
+    using P       = packeddist;  // 推定値と先行点を1語に詰め込む
+    using word_t  = P::word_t;
+    using count_t = std::int64_t;
+    std::int32_t n = G.size();
+
+    std::vector<word_t>       D(n, P::pack(graph::inf, graph::nil));
+    std::vector<std::uint8_t> queued(n, 0);  // 次の段のフロンティアにすでに加えたか否か
+    indices_t front(n), next(n);
+    count_t nf = 0;
+
+    D[s] = P::pack(0, graph::nil);
+    front[nf++] = s;
+    bool ok = true;
+    for (std::int32_t k = 0; nf > 0; k++) {
+        if (k == n) { ok = false; break; }  // 第|V|段でも推定値が減少した
+        count_t tail = 0;
+#pragma omp parallel
+        {
+            indices_t local;
+#pragma omp for schedule(dynamic, 64) nowait
+            for (count_t i = 0; i < nf; i++) {
+                index_t  u  = front[i];
+                weight_t du = P::dist(atomic_load(&D[u]));
+                for (const auto& e : G[u]) {
+                    index_t v = e.dst;
+                    if (write_min(&D[v], P::pack(du + e.w, u), P::shorter()) &&
+                        atomic_load(&queued[v]) == 0 && cas(&queued[v], std::uint8_t(0), std::uint8_t(1))) {
+                        local.push_back(v);
+                    }
+                }
+            }
+            count_t i = fetch_add(&tail, count_t(local.size()));
+            std::copy(local.begin(), local.end(), next.begin() + i);
+        }
+        front.swap(next); nf = tail;
+#pragma omp parallel for
+        for (count_t i = 0; i < nf; i++) { queued[front[i]] = 0; }
+    }
+
+    vertices_t V(n);
+    for (index_t v = 0; v < n; v++) { V[v].d = P::dist(D[v]); V[v].pi = P::pred(D[v]); }
+    return std::make_pair(ok, V);
+}
+
+
+/**
+ * @brief  負閉路を1つ取り出す
+ *
+ * @note   Bellman-Fordアルゴリズムが(いずれの進め方でも)falseを返した後の推定値と先行点Vを受け取る
+ *         先行点部分グラフGπに閉路があれば、それは負閉路である(緩和だけによって作られた閉路の重みは負である)
+ *         Gπに閉路が見つかるまで、すべての辺を走査して緩和することを繰り返し、見つかった閉路を返す
+ *         Gπの閉路の検出は、各頂点からπを辿り、今回の辿りですでに通った頂点に戻るか否かを調べてΘ(V)時間で行う
+ *
+ * @param  const Graph& G グラフG
+ * @param  vertices_t   V Bellman-Fordアルゴリズムが返した推定値と先行点
+ * @return 負閉路上の頂点を辺の向きの順に並べたもの(負閉路が見つからなければ空)
+ */
+template <class Graph>
+indices_t negativecycle(const Graph& G, vertices_t V)
+{
+    std::int32_t n = G.size();
+    indices_t mark(n);
+
+    // Gπの閉路を探す
+    auto findcycle = [&]() -> indices_t {
+        std::fill(mark.begin(), mark.end(), graph::nil);
+        for (index_t r = 0; r < n; r++) {
+            index_t v = r;
+            while (v != graph::nil && mark[v] == graph::nil) { mark[v] = r; v = V[v].pi; }  // rから辿った頂点にrの印を付ける
+            if (v == graph::nil || mark[v] != r) { continue; }  // 今回の辿りで通った頂点に戻らなかった
+            indices_t C{ v };
+            for (index_t u = V[v].pi; u != v; u = V[u].pi) { C.push_back(u); }
+            std::reverse(C.begin(), C.end());  // πは辺を逆向きに辿るので、反転して辺の向きの順にする
+            return C;
+        }
+        return indices_t();
+    };
+
+
+    for (std::int32_t i = 0; i <= n; i++) {
+        indices_t C = findcycle();
+        if (!C.empty()) { return C; }
+        bool changed = false;
+        for (index_t u = 0; u < n; u++) { for (const auto& e : G[u]) {
+                index_t v = e.dst;
+                if (V[u].d != graph::inf && V[v].d > V[u].d + e.w) { V[v].d = V[u].d + e.w; V[v].pi = u; changed = true; }
+            }
+        }
+        if (!changed) { break; }  // 負閉路は存在しない
+    }
+    return indices_t();
+}
 
 
 
@@ -0,0 +1,176 @@
+/**
+ * @brief  グラフアルゴリズムのベンチマーク
+ *
+ * @note   R-MAT, 2次元格子, Erdős–Rényi, べき乗則の4種類の合成グラフを頂点数2^scaleで生成し、
+ *         bfs, dfs, dijkstra, bellmanford, floydwarshall, prim, kruskal, scc, edmondskarp, fordfulkersonの実行時間を測定する
+ *         結果は1行に1回の測定をCSV形式で標準出力に書く
+ *           algorithm,graph,scale,n,m,seconds,edges_per_second,peak_rss_kb
+ *         edges_per_secondは入力の辺数mを実行時間で割ったものである. peak_rss_kbは測定中の最大常駐集合の大きさであり、
+ *         測定の直前に/proc/self/clear_refsで最大値を現在の値に戻してから/proc/self/statusのVmHWMを読む
+ *         (これができない環境では、プロセス開始以降の最大値getrusageを報告する)
+ *
+ * @note   使い方 : bench [maxscale [reps]]
+ *           maxscale : 最大のscale(既定値14). scaleは10から2ずつ増やす
+ *           reps     : 各測定の繰り返し回数(既定値1). 最短の実行時間を報告する
+ *         floydwarshallはΘ(V^3)時間、edmondskarpとfordfulkersonはΘ(V^2)の記憶量を要するので、
+ *         それぞれscale <= 10, scale <= 12に限って測定する
+ *
+ * @date   2026/10/15
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <sys/resource.h>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+#include "../Graph/graph.hpp"
+#include "../Graph/csr.hpp"
+#include "../Graph/flatmatrix.hpp"
+#include "../Graph/generator.hpp"
+#include "../BFS/bfs.hpp"
+#include "../DFS/dfs.hpp"
+#include "../Dijkstra/dijkstra.hpp"
+#include "../BellmanFord/bellmanford.hpp"
+#include "../FloydWarshall/floydwarshall.hpp"
+#include "../Prim/prim.hpp"
+#include "../Kruskal/kruskal.hpp"
+#include "../SCC/scc.hpp"
+#include "../EdmondsKarp/edmondskarp.hpp"
+#include "../FordFulkerson/fordfulkerson.hpp"
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**
+ * @brief  最大常駐集合の大きさの記録を現在の値に戻す(Linux 4.0以降)
+ * @note   直前の測定で解放したヒープをOSに返してから戻す(glibcのmallocは解放された領域を保持し続けるため)
+ * @return 戻せたか否か
+ */
+bool resetpeakrss()
+{
+#ifdef __GLIBC__
+    malloc_trim(0);
+#endif
+    std::FILE* fp = std::fopen("/proc/self/clear_refs", "w");
+    if (!fp) { return false; }
+    bool ok = std::fputs("5", fp) >= 0;
+    return std::fclose(fp) == 0 && ok;
+}
+
+
+/**
+ * @brief  最大常駐集合の大きさ[KB]を返す
+ */
+long peakrss()
+{
+    std::FILE* fp = std::fopen("/proc/self/status", "r");
+    if (fp) {
+        char line[256]; long kb = -1;
+        while (std::fgets(line, sizeof(line), fp)) {
+            if (std::strncmp(line, "VmHWM:", 6) == 0) { kb = std::atol(line + 6); break; }
+        }
+        std::fclose(fp);
+        if (kb >= 0) { return kb; }
+    }
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+    return ru.ru_maxrss;
+}
+
+
+/**
+ * @brief  fをreps回実行し、最短の実行時間を1行に出力する
+ */
+void measure(const char* algorithm, const std::string& graph, std::int32_t scale, std::int64_t n, std::int64_t m,
+             std::int32_t reps, const std::function<void()>& f)
+{
+    double best = 1e300; long rss = 0;
+    for (std::int32_t r = 0; r < reps; r++) {
+        resetpeakrss();
+        auto start = std::chrono::steady_clock::now();
+        f();
+        auto stop  = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double>(stop - start).count());
+        rss  = std::max(rss, peakrss());
+    }
+    std::printf("%s,%s,%d,%ld,%ld,%.6f,%.0f,%ld\n", algorithm, graph.c_str(), scale, long(n), long(m),
+                best, best > 0 ? m / best : 0.0, rss);
+    std::fflush(stdout);
+}
+
+
+/**
+ * @brief  1つのグラフに対してすべてのアルゴリズムを測定する
+ * @param  edges_t E 重み付きの有向グラフの辺リスト
+ */
+void run(const std::string& name, std::int32_t scale, std::int32_t n, edges_t E, std::int32_t reps)
+{
+    std::int64_t m = E.size();
+    csrgraph G(n, E);
+    index_t  s = 0;  // 単一始点の探索は、出次数が最大の頂点(多くの頂点に到達できる)から始める
+    for (index_t v = 0; v < n; v++) { if (G.degree(v) > G.degree(s)) { s = v; } }
+    volatile std::int64_t sink = 0;  // 結果を使い、計算が省かれないようにする
+
+    measure("bfs",         name, scale, n, m, reps, [&]() { sink += bfs(G, s)[n - 1].d; });
+    measure("dfs",         name, scale, n, m, reps, [&]() { sink += dfs(G).second[0]; });
+    measure("dijkstra",    name, scale, n, m, reps, [&]() { sink += dijkstra(G, s)[n - 1].d; });
+    measure("bellmanford", name, scale, n, m, reps, [&]() { sink += bellmanford(G, s).second[n - 1].d; });
+    measure("scc",         name, scale, n, m, reps, [&]() { sink += scc(G)[0]; });
+    if (scale <= 10) {
+        measure("floydwarshall", name, scale, n, m, reps, [&]() {
+            flatmatrix<weight_t> D(n, graph::inf);
+            for (index_t v = 0; v < n; v++) { D(v, v) = 0; }
+            for (auto& e : E) { if (e.src != e.dst) { D(e.src, e.dst) = std::min(D(e.src, e.dst), e.w); } }
+            floydwarshall(D);
+            sink += D(0, n - 1);
+        });
+    }
+
+    // 最小全域木は無向グラフとして扱う(primはsを含む連結成分の最小全域木を求める)
+    edges_t U = symmetrize(E);
+    csrgraph GU(n, U);
+    graph_t  AU = tograph(n, U);
+    measure("prim",    name, scale, n, U.size(), reps, [&]() { sink += prim(GU, s).second; });
+    measure("kruskal", name, scale, n, U.size(), reps, [&]() { sink += kruskal(AU).second; });
+
+    // 最大フローは辺の重みを容量とし、頂点0から頂点n - 1へ流す
+    if (scale <= 12) {
+        graph_t A = tograph(n, E);
+        measure("edmondskarp",   name, scale, n, m, reps, [&]() { sink += edmondskarp(A).execute(0, n - 1); });
+        measure("fordfulkerson", name, scale, n, m, reps, [&]() { sink += fordfulkerson(A).execute(0, n - 1); });
+    }
+}
+
+
+
+int main(int argc, char* argv[])
+{
+    std::int32_t maxscale = argc > 1 ? std::atoi(argv[1]) : 14;
+    std::int32_t reps     = argc > 2 ? std::atoi(argv[2]) : 1;
+
+    std::printf("algorithm,graph,scale,n,m,seconds,edges_per_second,peak_rss_kb\n");
+    for (std::int32_t scale = 10; scale <= maxscale; scale += 2) {
+        std::int32_t n = 1 << scale;
+        std::mt19937 mt(scale);  // 同じscaleでは常に同じグラフを生成する
+        auto weighted = [&mt](edges_t E) { randomweights(E, 1, 100, mt); return E; };
+        run("rmat",       scale, n, weighted(rmat(scale, 8, mt)), reps);
+        run("grid",       scale, n, weighted(grid2d(1 << (scale / 2), 1 << (scale - scale / 2))), reps);
+        run("erdosrenyi", scale, n, weighted(erdosrenyi(n, 8 * std::int64_t(n), mt)), reps);
+        run("powerlaw",   scale, n, weighted(powerlaw(n, 8 * std::int64_t(n), 2.5, mt)), reps);
+    }
+    return 0;
+}
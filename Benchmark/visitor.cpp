@@ -0,0 +1,159 @@
+/**
+ * @brief  訪問者(visitor)の呼び出しの費用を測定する
+ *
+ * @note   bfs, dfs, dijkstra, bellmanford, primを、次の3種類の訪問者で実行して実行時間を比べる
+ *           null     : nullvisitor. 事象の呼び出しはすべて消え、訪問者を受け取らない版と同じ機械語になる
+ *           inline   : 吟味した辺と緩和に成功した辺を数える訪問者. 呼び出しはインライン展開される
+ *           function : 同じ数え上げをstd::functionのメンバを介して行う訪問者(従来のコールバックの書き方)
+ *         inlineとfunctionは同じ事象を数えるので、数えた値が一致することも確かめる
+ *         結果は1行に1回の測定をCSV形式で標準出力に書く
+ *           algorithm,graph,visitor,seconds,examined,relaxed
+ *
+ * @note   使い方 : visitor [scale [reps]]
+ *           scale : 頂点数2^scale(既定値16)
+ *           reps  : 各測定の繰り返し回数(既定値3). 最短の実行時間を報告する
+ *
+ * @date   2026/10/15
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include "../Graph/graph.hpp"
+#include "../Graph/csr.hpp"
+#include "../Graph/generator.hpp"
+#include "../Graph/visitor.hpp"
+#include "../BFS/bfs.hpp"
+#include "../DFS/dfs.hpp"
+#include "../Dijkstra/dijkstra.hpp"
+#include "../BellmanFord/bellmanford.hpp"
+#include "../Prim/prim.hpp"
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief  吟味した辺と、緩和に成功した辺(bfsとdfsでは木辺)を数える訪問者
+ */
+struct counter : nullvisitor {
+    std::int64_t examined = 0;
+    std::int64_t relaxed  = 0;
+    void examine_edge(const edge&) { examined++; }
+    void tree_edge(const edge&)    { relaxed++; }
+    void edge_relaxed(const edge&) { relaxed++; }
+};
+
+
+/**
+ * @brief  事象をstd::functionのメンバに転送する訪問者
+ * @note   呼び出し先が実行時に決まるので、インライン展開されず、事象ごとに間接呼び出しが起こる
+ */
+struct functionvisitor : nullvisitor {
+    std::function<void(const edge&)> on_examine;
+    std::function<void(const edge&)> on_relax;
+    void examine_edge(const edge& e) { on_examine(e); }
+    void tree_edge(const edge& e)    { on_relax(e); }
+    void edge_relaxed(const edge& e) { on_relax(e); }
+};
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**
+ * @brief  fをreps回実行し、最短の実行時間を返す
+ */
+template <class Function>
+double measure(std::int32_t reps, Function f)
+{
+    double best = 1e300;
+    for (std::int32_t r = 0; r < reps; r++) {
+        auto start = std::chrono::steady_clock::now();
+        f();
+        auto stop  = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double>(stop - start).count());
+    }
+    return best;
+}
+
+
+/**
+ * @brief  1つのアルゴリズムを3種類の訪問者で測定し、数えた値が一致するか否かを返す
+ * @param  run 訪問者を受け取ってアルゴリズムを実行する関数オブジェクト(結果を要約した値を返す)
+ */
+template <class Run>
+bool compare(const char* algorithm, const std::string& graph, std::int32_t reps, Run run)
+{
+    volatile std::int64_t sink = 0;  // 結果を使い、計算が省かれないようにする
+    std::int64_t r0 = 0, r1 = 0, r2 = 0;
+    counter c, d;
+    functionvisitor fv;
+    fv.on_examine = [&d](const edge&) { d.examined++; };
+    fv.on_relax   = [&d](const edge&) { d.relaxed++; };
+
+    double t0 = measure(reps, [&]() { sink += r0 = run(nullvisitor()); });
+    double t1 = measure(reps, [&]() { c = counter(); sink += r1 = run(c); });
+    double t2 = measure(reps, [&]() { d = counter(); sink += r2 = run(fv); });
+    std::printf("%s,%s,null,%.6f,,\n", algorithm, graph.c_str(), t0);
+    std::printf("%s,%s,inline,%.6f,%ld,%ld\n", algorithm, graph.c_str(), t1, long(c.examined), long(c.relaxed));
+    std::printf("%s,%s,function,%.6f,%ld,%ld\n", algorithm, graph.c_str(), t2, long(d.examined), long(d.relaxed));
+    std::fflush(stdout);
+    bool ok = r0 == r1 && r1 == r2 && c.examined == d.examined && c.relaxed == d.relaxed;
+    if (!ok) { std::fprintf(stderr, "%s,%s: mismatch\n", algorithm, graph.c_str()); }
+    return ok;
+}
+
+
+/**
+ * @brief  1つのグラフに対してすべてのアルゴリズムを測定する
+ */
+bool run(const std::string& name, std::int32_t n, edges_t E, std::int32_t reps)
+{
+    csrgraph G(n, E);
+    csrgraph GU(n, symmetrize(E));
+    index_t  s = 0;  // 単一始点の探索は、出次数が最大の頂点から始める
+    for (index_t v = 0; v < n; v++) { if (G.degree(v) > G.degree(s)) { s = v; } }
+    auto sum = [](const vertices_t& V) {
+        std::int64_t x = 0;
+        for (const auto& v : V) { x += v.d == graph::inf ? -1 : v.d; }
+        return x;
+    };
+
+    bool ok = true;
+    ok = compare("bfs",         name, reps, [&](auto&& vis) { return sum(bfs(G, s, vis)); }) && ok;
+    ok = compare("dfs",         name, reps, [&](auto&& vis) { return sum(dfs(G, vis).first); }) && ok;
+    ok = compare("dijkstra",    name, reps, [&](auto&& vis) { return sum(dijkstra(G, s, vis)); }) && ok;
+    ok = compare("bellmanford", name, reps, [&](auto&& vis) { return sum(bellmanford(G, s, vis).second); }) && ok;
+    ok = compare("prim",        name, reps, [&](auto&& vis) { return std::int64_t(prim(GU, s, vis).second); }) && ok;
+    return ok;
+}
+
+
+
+int main(int argc, char* argv[])
+{
+    std::int32_t scale = argc > 1 ? std::atoi(argv[1]) : 16;
+    std::int32_t reps  = argc > 2 ? std::atoi(argv[2]) : 3;
+    std::int32_t n     = 1 << scale;
+    std::mt19937 mt(scale);
+    auto weighted = [&mt](edges_t E) { randomweights(E, 1, 100, mt); return E; };
+
+    std::printf("algorithm,graph,visitor,seconds,examined,relaxed\n");
+    bool ok = run("rmat", n, weighted(rmat(scale, 8, mt)), reps);
+    ok = run("grid", n, weighted(grid2d(1 << (scale / 2), 1 << (scale - scale / 2))), reps) && ok;
+    std::fprintf(stderr, "%s\n", ok ? "ok" : "NG");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,461 @@
+/**
+ * @brief  縮約階層(contraction hierarchies)による2点間最短路問題の前処理と問い合わせ
+ *
+ * @note   道路網のような静的なグラフに何度も2点間最短路を問い合わせる場合、前処理によって問い合わせを高速化できる
+ *         縮約階層では、頂点を1つずつ順に縮約(contract)する. 頂点vの縮約とは、vをグラフから取り除き、
+ *         vを経由する最短路u -> v -> xが失われる場合に限って近道(shortcut)(u, x)を加える操作である
+ *         w(u, v) + w(v, x)以下の重みを持ち、vを経由しない道(証人(witness))があれば近道は必要ない
+ *
+ *         縮約した順に頂点に順位rankを付けると、任意の2頂点s, tについて、順位が上がってから下がる(up-down)最短路が存在する
+ *         そこで、問い合わせでは、sからは順位の高い頂点に向かう辺だけを、tからは順位の高い頂点から来る辺だけを
+ *         逆向きに辿る双方向のDijkstraのアルゴリズムを行う. 両方向とも階層の上の方の少数の頂点しか探索しない
+ *
+ * @date   2026/10/15
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef __CH_HPP__
+#define __CH_HPP__
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <cstdint>
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../Graph/graph.hpp"
+#include "../Graph/csr.hpp"
+#include "../PriorityQueue/pqueue.hpp"
+#include "../PriorityQueue/dheap.hpp"
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief  縮約階層の辺
+ * @note   mid == NILならば元のグラフの辺であり、そうでなければ中間頂点midを経由する近道である
+ */
+struct charc {
+    index_t  dst;  /**< 辺の終点(下向きのグラフでは、元の辺の始点) */
+    weight_t w;    /**< 辺の重み */
+    index_t  mid;  /**< 近道の中間頂点 */
+};
+
+
+/**
+ * @brief  縮約階層の片方向のグラフ(CSR形式)
+ */
+struct chgraph {
+    offsets_t          offsets;  /**< 頂点uの辺はarcs[offsets[u]..offsets[u+1]-1]である */
+    std::vector<charc> arcs;     /**< 辺 */
+
+    /**< @brief 頂点uの辺の範囲[first, last) */
+    struct range {
+        const charc* first;
+        const charc* last;
+        const charc* begin() const { return first; }
+        const charc* end()   const { return last;  }
+    };
+
+    range operator[](index_t u) const { return range{ arcs.data() + offsets[u], arcs.data() + offsets[u + 1] }; }
+
+    /**< @brief 頂点uの辺のうち終点がvであるものを返す(なければnullptr) */
+    const charc* find(index_t u, index_t v) const
+    {
+        for (const auto& a : (*this)[u]) { if (a.dst == v) { return &a; } }
+        return nullptr;
+    }
+};
+
+
+/**
+ * @brief  縮約階層
+ *
+ * @note   up[u]には、元のグラフ(と近道)の辺(u, v)のうちrank[u] < rank[v]であるものを格納する
+ *         down[v]には、辺(u, v)のうちrank[u] > rank[v]であるものを、向きを逆にして(dst = uとして)格納する
+ *         近道(u, x)の中間頂点vは両端よりも順位が低いので、近道を構成する2辺は下向きのdown[v]と上向きのup[v]にある
+ */
+struct chierarchy {
+    std::int32_t n;     /**< 頂点数 */
+    indices_t    rank;  /**< 各頂点の順位(縮約した順番) */
+    chgraph      up;    /**< 上向きのグラフ */
+    chgraph      down;  /**< 下向きのグラフ(逆向きに格納) */
+
+    chierarchy() : n(0) {}
+
+    /**
+     * @brief  重み付き有向グラフGの縮約階層を構築する
+     *
+     * @note   頂点の縮約順序は辺差分(edge difference)によって決める. 頂点vの辺差分とは、vを縮約したときに加わる近道の数から、
+     *         取り除かれるvの辺の数を引いたものである. 辺差分が小さい頂点から縮約すればグラフは疎なまま保たれる
+     *         これに縮約済みの隣接頂点の数を加えたものを優先度とし、縮約がグラフ全体に一様に広がるようにする
+     *         優先度は遅延評価する. すなわち、最小の優先度を持つ頂点を取り出したときに優先度を計算し直し、
+     *         それが次の最小値より大きければキューに戻す
+     *
+     * @note   証人探索は、近道の候補(u, x)ごとではなく、入辺の始点uごとに1回のDijkstraのアルゴリズムで行う
+     *         探索は、距離がw(u, v) + max w(v, x)を超えるか、limit個の頂点を確定した時点で打ち切る
+     *         打ち切りによって不要な近道が加わることはあるが、必要な近道が欠けることはない
+     *
+     * @tparam Graph グラフの表現(graph_tまたはcsrgraph)
+     * @param  const Graph&  G     非負の重み付き有向グラフG
+     * @param  std::int32_t  limit 証人探索で確定する頂点数の上限
+     */
+    template <class Graph>
+    explicit chierarchy(const Graph& G, std::int32_t limit = 500);
+
+    /**
+     * @brief  縮約階層をファイルに書き出す
+     * @return 書き出しに成功すればtrue
+     */
+    bool save(const std::string& path) const;
+
+    /**
+     * @brief  save()で書き出したファイルから縮約階層を読み込む
+     * @note   見出しの頂点数と辺数をファイルの大きさと照合してから配列を確保し、offsetsの単調性、辺の終点と中間頂点の範囲、
+     *         順位と近道の整合性を検査する. 読み込みに失敗した場合、縮約階層は変更されない
+     * @return 読み込みに成功すればtrue(ファイルの形式が異なるか、壊れていればfalse)
+     */
+    bool load(const std::string& path);
+
+    /**< @brief 近道の数を返す */
+    std::size_t shortcuts() const
+    {
+        std::size_t k = 0;
+        for (const auto& a : up.arcs)   { k += (a.mid != graph::nil); }
+        for (const auto& a : down.arcs) { k += (a.mid != graph::nil); }
+        return k;
+    }
+
+    /**
+     * @brief  辺(u, x)(近道を含む)を元のグラフの辺の列に展開し、u以降の頂点をpの末尾に加える
+     * @note   近道(u, x)の中間頂点をvとすると、(u, v)はdown[v]に、(v, x)はup[v]にある
+     */
+    void unpack(index_t u, index_t x, index_t mid, indices_t& p) const
+    {
+        if (mid == graph::nil) { p.push_back(x); return; }
+        const charc* a = down.find(mid, u);  // 辺(u, mid)
+        const charc* b = up.find(mid, x);    // 辺(mid, x)
+        unpack(u, mid, a->mid, p);
+        unpack(mid, x, b->mid, p);
+    }
+};
+
+
+/**
+ * @brief  縮約階層に対する2点間最短路の問い合わせ構造体
+ * @note   作業領域はp2pqueryと同じく版付きで使い回す. キューは添字付きd分ヒープなので、記憶量は辺の数によらずΘ(V)である
+ */
+struct chquery {
+    using stamp_t = std::uint32_t;
+
+    /**< @brief 一方向の探索の作業領域 */
+    struct workspace {
+        array_t              d;     /**< 推定値 */
+        indices_t            pi;    /**< 先行点 */
+        std::vector<const charc*> arc;  /**< 先行点からの辺 */
+        std::vector<stamp_t> seen;  /**< seen[v] == versionならば、今回の問い合わせでvに到達している */
+        dheap<weight_t>      Q;     /**< 最短路推定値をキーとするmin優先度付きキュー */
+
+        explicit workspace(std::size_t n) : d(n), pi(n), arc(n), seen(n, 0), Q(n) {}
+    };
+
+    const chierarchy& H;
+    stamp_t   version;
+    workspace F, B;       /**< 上向きのグラフでsから、下向きのグラフでtから探索する作業領域 */
+    index_t   meet;       /**< 直前の問い合わせで両方向の探索が出会った頂点 */
+    std::int64_t settled; /**< 直前の問い合わせで確定した頂点の数 */
+
+    explicit chquery(const chierarchy& H)
+        : H(H), version(0), F(H.n), B(H.n), meet(graph::nil), settled(0) {}
+
+    /**
+     * @brief  sからtへの最短路重みを返す(道がなければ∞)
+     * @note   各方向の探索は、キューの最小キーがそれまでに見つけた最良の重みμ以上になるまで続ける
+     *         上向きの探索は途中で打ち切れないので(最短路の頂上の順位は分からない)、両方向とも階層の頂上まで探索しうるが、
+     *         上向きの辺は少ないので探索される頂点はごく一部である
+     */
+    weight_t distance(index_t s, index_t t)
+    {
+        if (++version == 0) {
+            std::fill(F.seen.begin(), F.seen.end(), 0); std::fill(B.seen.begin(), B.seen.end(), 0);
+            version = 1;
+        }
+        F.Q.clear(); B.Q.clear(); meet = graph::nil; settled = 0;
+        weight_t mu = graph::inf;
+        set(F, s, 0, graph::nil, nullptr); F.Q.push(s, 0);
+        set(B, t, 0, graph::nil, nullptr); B.Q.push(t, 0);
+
+        // 作業領域WでグラフGを1歩探索する. Oは反対側の作業領域である
+        auto step = [&](const chgraph& G, workspace& W, workspace& O) -> void {
+            index_t u = W.Q.extract().first;
+            settled++;
+            if (O.seen[u] == version && W.d[u] + O.d[u] < mu) { mu = W.d[u] + O.d[u]; meet = u; }
+            for (const auto& a : G[u]) {
+                weight_t d = W.d[u] + a.w;
+                if (W.seen[a.dst] != version || d < W.d[a.dst]) {
+                    set(W, a.dst, d, u, &a);
+                    W.Q.push(a.dst, d);  // a.dstがQに含まれていれば、そのキーを減少させる
+                }
+            }
+        };
+
+
+        while (true) {
+            bool f = !F.Q.empty() && F.Q.top().second < mu;
+            bool b = !B.Q.empty() && B.Q.top().second < mu;
+            if (!f && !b) { break; }
+            if (f && (!b || F.Q.top().second <= B.Q.top().second)) { step(H.up,   F, B); }
+            else                                              { step(H.down, B, F); }
+        }
+        return mu;
+    }
+
+    /**
+     * @brief  直前の問い合わせで求めた最短路を、近道を展開した元のグラフの頂点の列として返す(道がなければ空)
+     */
+    indices_t path() const
+    {
+        indices_t p;
+        if (meet == graph::nil) { return p; }
+        std::vector<std::pair<index_t, const charc*>> up;  // s ~> meetの上向きの辺を逆順に集める
+        for (index_t v = meet; F.pi[v] != graph::nil; v = F.pi[v]) { up.emplace_back(F.pi[v], F.arc[v]); }
+        index_t s = up.empty() ? meet : up.back().first;
+        p.push_back(s);
+        for (auto it = up.rbegin(); it != up.rend(); ++it) { H.unpack(it->first, it->second->dst, it->second->mid, p); }
+        for (index_t v = meet; B.pi[v] != graph::nil; v = B.pi[v]) {  // meet ~> tは下向きの辺を逆向きに辿る
+            H.unpack(v, B.pi[v], B.arc[v]->mid, p);
+        }
+        return p;
+    }
+
+private:
+    void set(workspace& W, index_t v, weight_t d, index_t pi, const charc* a)
+    {
+        W.d[v] = d; W.pi[v] = pi; W.arc[v] = a; W.seen[v] = version;
+    }
+};
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+template <class Graph>
+chierarchy::chierarchy(const Graph& G, std::int32_t limit) : n(G.size()), rank(n, graph::nil)
+{
+    using pair_t  = std::pair<index_t, weight_t>;
+    using stamp_t = std::uint32_t;
+    struct arc { index_t v; weight_t w; index_t mid; };
+    struct shortcut { index_t u, x; weight_t w; };
+    struct cmp { bool operator () (const pair_t& p, const pair_t& q) { return p.second > q.second; } };
+
+    std::vector<std::vector<arc>> out(n), in(n);      // 縮約されていない頂点の間の辺(近道を含む)
+    std::vector<std::vector<charc>> ups(n), downs(n); // 縮約時に確定した上向きと下向きの辺
+    std::vector<std::int32_t> deleted(n, 0);          // 縮約済みの隣接頂点の数
+    std::size_t arcs = 0;
+
+    // 辺(u, x)を加える. すでに辺(u, x)があれば、重みの小さいほうを残す
+    auto addarc = [&](index_t u, index_t x, weight_t w, index_t mid) -> void {
+        for (auto& a : out[u]) {
+            if (a.v == x) {
+                if (w < a.w) {
+                    a.w = w; a.mid = mid;
+                    for (auto& b : in[x]) { if (b.v == u) { b.w = w; b.mid = mid; } }
+                }
+                return;
+            }
+        }
+        out[u].push_back(arc{ x, w, mid }); in[x].push_back(arc{ u, w, mid });
+        arcs++;
+    };
+    for (index_t u = 0; u < n; u++) {
+        for (const auto& e : G[u]) {
+            if (e.src != e.dst) { addarc(e.src, e.dst, e.w, graph::nil); }
+        }
+    }
+
+    // 証人探索の作業領域
+    array_t              wd(n);
+    std::vector<stamp_t> wseen(n, 0);
+    stamp_t              wversion = 0;
+    pqueue<pair_t, cmp>  WQ(2 * arcs + 1);
+    // 頂点vを経由せずにuから到達できる頂点への距離を、maxwまでの範囲で求める
+    auto witness = [&](index_t u, index_t v, weight_t maxw) -> void {
+        if (++wversion == 0) { std::fill(wseen.begin(), wseen.end(), 0); wversion = 1; }
+        if (WQ.H.length < arcs + 1) { WQ = pqueue<pair_t, cmp>(2 * arcs + 1); }
+        WQ.clear();
+        wd[u] = 0; wseen[u] = wversion; WQ.insert(std::make_pair(u, 0));
+        for (std::int32_t k = 0; !WQ.empty() && k < limit; ) {
+            pair_t p = WQ.extract();
+            index_t y = p.first;
+            if (wd[y] < p.second) { continue; }
+            if (wd[y] > maxw) { break; }
+            k++;
+            for (const auto& a : out[y]) {
+                if (a.v == v) { continue; }
+                weight_t d = wd[y] + a.w;
+                if (wseen[a.v] != wversion || d < wd[a.v]) {
+                    wd[a.v] = d; wseen[a.v] = wversion;
+                    WQ.insert(std::make_pair(a.v, d));
+                }
+            }
+        }
+    };
+    // 頂点vを縮約したときに必要な近道を求める
+    auto contract = [&](index_t v, std::vector<shortcut>& S) -> void {
+        S.clear();
+        weight_t maxout = 0;
+        for (const auto& b : out[v]) { maxout = std::max(maxout, b.w); }
+        for (const auto& a : in[v]) {
+            witness(a.v, v, a.w + maxout);
+            for (const auto& b : out[v]) {
+                if (b.v == a.v) { continue; }
+                weight_t w = a.w + b.w;
+                if (wseen[b.v] != wversion || wd[b.v] > w) { S.push_back(shortcut{ a.v, b.v, w }); }
+            }
+        }
+    };
+    // 頂点vの優先度(辺差分 + 縮約済みの隣接頂点の数)
+    std::vector<shortcut> S;
+    auto priority = [&](index_t v) -> weight_t {
+        contract(v, S);
+        return weight_t(S.size()) - weight_t(in[v].size() + out[v].size()) + deleted[v];
+    };
+    // vを隣接リストLから取り除く
+    auto erase = [](std::vector<arc>& L, index_t v) -> void {
+        L.erase(std::remove_if(L.begin(), L.end(), [v](const arc& a) { return a.v == v; }), L.end());
+    };
+
+
+    pqueue<pair_t, cmp> Q(n);
+    for (index_t v = 0; v < n; v++) { Q.insert(std::make_pair(v, priority(v))); }
+    for (index_t r = 0; !Q.empty(); ) {
+        index_t  v = Q.extract().first;
+        weight_t p = priority(v);
+        if (!Q.empty() && p > Q[0].second) { Q.insert(std::make_pair(v, p)); continue; }  // 遅延評価
+
+        // vを縮約する. 残っている辺はすべて順位の高い頂点との辺である
+        rank[v] = r++;
+        for (const auto& b : out[v]) { ups[v].push_back(charc{ b.v, b.w, b.mid }); erase(in[b.v], v);  deleted[b.v]++; arcs--; }
+        for (const auto& a : in[v])  { downs[v].push_back(charc{ a.v, a.w, a.mid }); erase(out[a.v], v); deleted[a.v]++; arcs--; }
+        for (const auto& c : S)      { addarc(c.u, c.x, c.w, v); }
+        out[v].clear(); out[v].shrink_to_fit();
+        in[v].clear();  in[v].shrink_to_fit();
+    }
+
+    // 上向きと下向きのグラフをCSR形式にまとめる
+    auto flatten = [this](chgraph& C, const std::vector<std::vector<charc>>& L) {
+        C.offsets.assign(n + 1, 0);
+        for (index_t u = 0; u < n; u++) { C.offsets[u + 1] = C.offsets[u] + L[u].size(); }
+        C.arcs.clear(); C.arcs.reserve(C.offsets[n]);
+        for (index_t u = 0; u < n; u++) { C.arcs.insert(C.arcs.end(), L[u].begin(), L[u].end()); }
+    };
+    flatten(up, ups); flatten(down, downs);
+}
+
+
+inline bool chierarchy::save(const std::string& path) const
+{
+    std::ofstream ofs(path, std::ios::binary);
+    if (!ofs) { return false; }
+    const char magic[4] = { 'C', 'H', 'H', '1' };
+    std::int64_t mu = up.arcs.size(), md = down.arcs.size();
+    ofs.write(magic, 4);
+    ofs.write(reinterpret_cast<const char*>(&n),  sizeof(n));
+    ofs.write(reinterpret_cast<const char*>(&mu), sizeof(mu));
+    ofs.write(reinterpret_cast<const char*>(&md), sizeof(md));
+    ofs.write(reinterpret_cast<const char*>(rank.data()),         sizeof(index_t)  * n);
+    ofs.write(reinterpret_cast<const char*>(up.offsets.data()),   sizeof(offset_t) * (n + 1));
+    ofs.write(reinterpret_cast<const char*>(up.arcs.data()),      sizeof(charc)    * mu);
+    ofs.write(reinterpret_cast<const char*>(down.offsets.data()), sizeof(offset_t) * (n + 1));
+    ofs.write(reinterpret_cast<const char*>(down.arcs.data()),    sizeof(charc)    * md);
+    return bool(ofs);
+}
+
+
+inline bool chierarchy::load(const std::string& path)
+{
+    std::ifstream ifs(path, std::ios::binary);
+    if (!ifs) { return false; }
+    char magic[4];
+    std::int32_t k = 0; std::int64_t mu = 0, md = 0;
+    ifs.read(magic, 4);
+    if (!ifs || std::string(magic, 4) != "CHH1") { return false; }
+    ifs.read(reinterpret_cast<char*>(&k),  sizeof(k));
+    ifs.read(reinterpret_cast<char*>(&mu), sizeof(mu));
+    ifs.read(reinterpret_cast<char*>(&md), sizeof(md));
+    if (!ifs || k < 0 || mu < 0 || md < 0) { return false; }
+
+    // 配列を確保する前に、見出しの大きさが残りのファイルの大きさと一致することを確かめる(壊れた見出しで巨大な領域を確保しない)
+    std::streamoff here = ifs.tellg();
+    ifs.seekg(0, std::ios::end);
+    std::uint64_t rest = std::uint64_t(ifs.tellg() - here);
+    ifs.seekg(here);
+    if (std::uint64_t(mu) > rest / sizeof(charc) || std::uint64_t(md) > rest / sizeof(charc) ||
+        sizeof(index_t) * std::uint64_t(k) + 2 * sizeof(offset_t) * (std::uint64_t(k) + 1) + sizeof(charc) * std::uint64_t(mu + md) != rest) {
+        return false;
+    }
+
+    // 一時的な縮約階層に読み込み、すべて検査してから入れ替える(失敗しても*thisは変わらない)
+    chierarchy H;
+    H.n = k;
+    H.rank.resize(k); H.up.offsets.resize(k + 1); H.up.arcs.resize(mu); H.down.offsets.resize(k + 1); H.down.arcs.resize(md);
+    ifs.read(reinterpret_cast<char*>(H.rank.data()),         sizeof(index_t)  * k);
+    ifs.read(reinterpret_cast<char*>(H.up.offsets.data()),   sizeof(offset_t) * (k + 1));
+    ifs.read(reinterpret_cast<char*>(H.up.arcs.data()),      sizeof(charc)    * mu);
+    ifs.read(reinterpret_cast<char*>(H.down.offsets.data()), sizeof(offset_t) * (k + 1));
+    ifs.read(reinterpret_cast<char*>(H.down.arcs.data()),    sizeof(charc)    * md);
+    if (!ifs) { return false; }
+
+    // 順位は0, 1, ..., n-1の置換である
+    std::vector<std::uint8_t> used(k, 0);
+    for (auto r : H.rank) {
+        if (r < 0 || r >= k || used[r]) { return false; }
+        used[r] = 1;
+    }
+    auto inrange = [k](index_t v) { return 0 <= v && v < k; };
+
+    // offsetsは0から辺数まで単調に増加し、辺の終点は頂点で、上向きのグラフの辺は順位の高い頂点に向かい、下向きのグラフの辺は順位の高い頂点から来る
+    for (const chgraph* C : { &H.up, &H.down }) {
+        if (C->offsets[0] != 0 || C->offsets[k] != offset_t(C->arcs.size())) { return false; }
+        for (index_t u = 0; u < k; u++) {
+            if (C->offsets[u] > C->offsets[u + 1]) { return false; }
+            for (const auto& a : (*C)[u]) {
+                if (!inrange(a.dst) || H.rank[a.dst] <= H.rank[u] || a.w < 0) { return false; }
+                if (a.mid != graph::nil && !inrange(a.mid)) { return false; }
+            }
+        }
+    }
+
+    // 近道(u, x)の中間頂点vは両端より順位が低く、辺(u, v)と(v, x)が存在する(unpackが範囲外を読まず、必ず停止する)
+    for (index_t v = 0; v < k; v++) {
+        auto valid = [&](index_t u, index_t x, index_t mid) {
+            return mid == graph::nil ||
+                   (H.rank[mid] < H.rank[u] && H.rank[mid] < H.rank[x] && H.down.find(mid, u) && H.up.find(mid, x));
+        };
+        for (const auto& a : H.up[v])   { if (!valid(v, a.dst, a.mid)) { return false; } }
+        for (const auto& a : H.down[v]) { if (!valid(a.dst, v, a.mid)) { return false; } }
+    }
+
+    n = H.n; rank.swap(H.rank); up.offsets.swap(H.up.offsets); up.arcs.swap(H.up.arcs);
+    down.offsets.swap(H.down.offsets); down.arcs.swap(H.down.arcs);
+    return true;
+}
+
+
+#endif  // end of __CH_HPP__
@@ -0,0 +1,94 @@
+/**
+ * @brief  縮約階層の動作確認
+ * @date   2026/10/15
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include "ch.hpp"
+#include "../Dijkstra/dijkstra.hpp"
+
+
+
+int main(void)
+{
+    using namespace std;
+    using clock = chrono::steady_clock;
+    auto ms = [](clock::time_point a, clock::time_point b) { return chrono::duration<double, milli>(b - a).count(); };
+
+    // 道路網に見立てたk×kの格子グラフ(往路と復路で重みが異なる有向グラフ)
+    const int k = 120, n = k * k, queries = 1000;
+    mt19937 mt(1);
+    uniform_int_distribution<weight_t> wdist(1, 100);
+    uniform_int_distribution<index_t>  vdist(0, n - 1);
+    edges_t E;
+    for (index_t i = 0; i < k; i++) {
+        for (index_t j = 0; j < k; j++) {
+            index_t u = i * k + j;
+            if (j + 1 < k) { E.emplace_back(u, u + 1, wdist(mt)); E.emplace_back(u + 1, u, wdist(mt)); }
+            if (i + 1 < k) { E.emplace_back(u, u + k, wdist(mt)); E.emplace_back(u + k, u, wdist(mt)); }
+        }
+    }
+    csrgraph G(n, E);
+
+    auto t0 = clock::now();
+    chierarchy C(G);
+    auto t1 = clock::now();
+    cout << "preprocessing : " << ms(t0, t1) << " ms, " << C.shortcuts() << " shortcuts" << endl;
+
+    // 階層をファイルに書き出し、読み込み直したものに問い合わせる
+    const string file = "ch.bin";
+    chierarchy H;
+    bool ok = C.save(file) && H.load(file);
+
+    // 壊れたファイルは読み込まず、読み込み済みの階層も変更しない
+    auto corrupt = [&](streamoff at, const void* p, size_t size) {
+        C.save(file);
+        fstream fs(file, ios::in | ios::out | ios::binary);
+        fs.seekp(at); fs.write(static_cast<const char*>(p), size);
+    };
+    const streamoff arcs = 24 + sizeof(index_t) * n + sizeof(offset_t) * (n + 1);  // 上向きのグラフの最初の辺の位置
+    const int64_t huge = int64_t(1) << 60;
+    const index_t bad  = n + 7;
+    corrupt(8, &huge, sizeof(huge));  ok = ok && !H.load(file);  // 辺数が大きすぎる
+    corrupt(arcs, &bad, sizeof(bad)); ok = ok && !H.load(file);  // 範囲外の終点
+    corrupt(24, &bad, sizeof(bad));   ok = ok && !H.load(file);  // 範囲外の順位
+    ok = ok && H.n == n && H.up.arcs.size() == C.up.arcs.size();
+    remove(file.c_str());
+
+    chquery Q(H);
+    double tq = 0, td = 0;
+    int64_t settled = 0;
+    for (int q = 0; q < queries && ok; q++) {
+        index_t s = vdist(mt), t = vdist(mt);
+        auto a = clock::now();
+        weight_t d = Q.distance(s, t);
+        indices_t p = Q.path();
+        auto b = clock::now();
+        weight_t expected = dijkstra(G, s)[t].d;
+        auto c = clock::now();
+        tq += ms(a, b); td += ms(b, c); settled += Q.settled;
+
+        // 展開した道が元のグラフの道であり、その重みが最短路重みに等しいか確かめる
+        weight_t w = 0;
+        for (size_t i = 0; i + 1 < p.size(); i++) {
+            weight_t c = graph::inf;
+            for (const auto& e : G[p[i]]) { if (e.dst == p[i + 1]) { c = min(c, e.w); } }
+            w += c;
+        }
+        ok = ok && d == expected && !p.empty() && p.front() == s && p.back() == t && w == d;
+    }
+    cout << "query (ch)    : " << tq / queries * 1000 << " us, " << settled / queries << " settled vertices" << endl;
+    cout << "dijkstra      : " << td / queries * 1000 << " us" << endl;
+    cout << (ok ? "ok" : "ng") << endl;
+    return 0;
+}
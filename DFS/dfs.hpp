@@ -19,12 +19,15 @@
 // 必要なヘッダファイルのインクルード
 //****************************************
 
+#include <utility>
+#include <vector>
 #include "../Graph/graph.hpp"
+#include "../Graph/visitor.hpp"
 
 
 
 //****************************************
-// 関数プロトタイプ
+// 関数の定義
 //****************************************
 
 /**
@@ -40,7 +43,7 @@
  *         この事象を記録する. 先行点部分グラフが木である幅優先探索と違い、深さ優先探索では複数の始点から探索を繰り返すことがあるから、
  *         先行点部分グラフが複数の木から構成されることがある. そこで、深さ優先探索の先行点部分グラフ(predecessor subgraph)を
  *         幅優先探索と少し違って、Gπ = (V, Eπ)と定義する. ここで
- *           Eπ = {(v.π, v) : v ∈ V かつ v.π != NIL }
+ *           Eπ = { (v.π, v) : v ∈ V かつ v.π != NIL }
  *         である. 深さ優先探索の先行点部分グラフは複数の深さ優先木(depth-first tree)から構成される深さ優先森(depth-first forest)
  *         を形成する. Eπに属する辺を木辺(tree edge)と呼ぶ
  *
@@ -58,10 +61,118 @@
  *           u.d < u.f
  *         が成立する. 頂点uは時刻u.d以前はWHITE, 時刻u.dと時刻u.fの間はGRAY, 時刻u.f以降はBLACKである
  *
+ * @note   DFSの実行時間はΘ(V + E)である
+ *
+ * @note   深さ優先探索の興味深い性質の1つに入力されたグラフG = (V, E)の辺の分類が探索を使ってできることがある
+ *         辺の分類からグラフに関する重要な情報が収集できる. たとえば、有向グラフが非巡回であるための必要十分条件が、
+ *         深さ優先探索によって「後退」辺が生じないことである
+ *
+ *         G上の深さ優先探索が生成する深さ優先森Gπを用いて4種類の辺を定義できる
+ *
+ *         1. 深さ優先森Gπを構成する辺を木辺(tree edge)という. 辺(u, v)を探索することでvを始めて発見したならば、辺(u, v)は木片である
+ *
+ *         2. ある深さ優先木のある頂点uとその祖先vを結ぶ辺(u, v)を後退辺(back edge)という
+ *            有向グラフが自己ループを含むことがあるが、これは後退辺とみなす
+ *
+ *         3. ある深さ優先木のある頂点uとその子孫vを結ぶ辺(u, v)で木片ではないものを前進辺(forward edge)という
+ *
+ *         4. 上記以外のすべての辺を横断辺(cross edge)という. 一方の頂点が祖先でない限り、同じ深さ優先木の頂点を結ぶものであってよいし、
+ *            また、2つの深さ優先木を結ぶものであっても良い
+ *
+ *
+ * @note   DFSアルゴリズムは辺に出会ったときに、手持ちの情報だけからこの辺を分類できることがある
+ *         辺(u, v)を最初に探索した時、頂点vの色がこの辺について何かを教えてくれるというのがキーとなるアイデアである
+ *
+ *         1. WHITEは木片であることを示す
+ *         2. GRAYは後退辺であることを示す
+ *         3. BLACKは前進辺あるいは横断辺であることを示す
+ *
+ *
+ * @note   各頂点は(頂点, 次に調べる辺の位置)を積んだ明示的なスタックで訪問する. 深さ優先木が深くても呼び出しスタックは溢れず、
+ *         各辺はちょうど1回だけ吟味される. 探索の各事象で訪問者visの同名のメンバ関数を呼び出す(Graph/visitor.hpp)
+ *
+ * @tparam Graph   グラフの表現(graph_tまたはcsrgraph)
+ * @tparam Visitor 訪問者の型(nullvisitorを継承したもの)
  * @param  グラフG(無向でも有向でもよい)
- * @param  深さ優先森
+ * @param  Visitor&& vis 訪問者
+ * @return 深さ優先森
+ */
+template <class Graph, class Visitor>
+std::pair<vertices_t, array_t> dfs(const Graph& G, Visitor&& vis)
+{
+    struct frame { index_t u; std::size_t i; };  // 頂点u, 次に調べるuの辺の位置
+    std::int32_t n = G.size();
+    vertices_t vs(n);
+    array_t f(n);
+    weight_t time;
+    std::vector<frame> S;
+
+    // 白頂点uを発見する
+    auto discover = [&](index_t u) -> void {
+        time = time + 1;             // timeを1進め、
+        vs[u].d = time;              // timeの値を発見時刻u.dとして記録し、
+        vs[u].color = color::gray;   // uを灰に彩色する
+        vis.discover_vertex(u);
+        S.push_back(frame{ u, 0 });
+    };
+    // スタックを用いて白頂点uを訪問する
+    auto visit = [&](index_t u) -> void {
+        discover(u);
+        // 各頂点v ∈ Adj[u]を吟味するので、深さ優先探索は辺(u, v)を探索する(explore)という
+        while (!S.empty()) {
+            frame& top = S.back();
+            u = top.u;
+            const auto& adj = G[u];
+            if (top.i < adj.size()) {  // uの隣接リストの中でまだ調べていない辺が存在する場合、
+                const auto e = adj[top.i++];
+                index_t v = e.dst;
+                vis.examine_edge(e);
+                if (vs[v].color == color::white) {  // vが白なら木辺であり、vを訪問する
+                    vis.tree_edge(e);
+                    vs[v].pi = u;
+                    discover(v);
+                }
+                else if (vs[v].color == color::gray) { vis.back_edge(e); }
+                else                                 { vis.forward_or_cross_edge(e); }
+            }
+            else { // uの隣接リストを全て調べている場合、
+                S.pop_back();                // スタックから先頭の要素をポップし、
+                vs[u].color = color::black;  // uを黒に彩色し、
+                time = time + 1;             // timeを進め、
+                f[u] = time;                 // 終了時刻をu.fに記録する
+                vis.finish_vertex(u);
+            }
+        }
+    };
+
+
+    for (index_t u = 0; u < n; u++) {
+        vs[u].color = color::white;            // 頂点をすべて白に彩色し、
+        vs[u].pi    = graph::nil;              // π属性をNILに初期化する
+        vis.initialize_vertex(u);
+    }
+    time = 0;                                  // 時刻カウンターを初期化
+    for (auto u = 0; u < n; u++) {             // Vの各頂点を順番に調べ、
+        if (vs[u].color == color::white) {     // 白頂点を発見すると、
+            vis.start_vertex(u);
+            visit(u);                          // visitを呼び出して訪問する
+            // visitを呼び出すたびに、頂点uが深さ優先森の新しい木の根になる
+        }
+    }
+    // DFSが終了した時、各頂点uには発見時刻(discovery time)u.dと終了時刻(finishing time)u.fが割り当てられている
+
+    return std::make_pair(vs, f);
+}
+
+
+/**
+ * @brief  深さ優先探索を行います(事象を受け取らない)
  */
-std::pair<vertices_t, array_t> dfs(const graph_t& G);
+template <class Graph>
+std::pair<vertices_t, array_t> dfs(const Graph& G)
+{
+    return dfs(G, nullvisitor());
+}
 
 
 
@@ -10,8 +10,12 @@
 // 必要なヘッダファイルのインクルード
 //****************************************
 
+#include <algorithm>
+#include <cstdint>
 #include <iostream>
+#include <random>
 #include "dsp.hpp"
+#include "../Graph/atomic.hpp"
 
 
 
@@ -62,6 +66,33 @@ std::pair<indices_t, array_t>  dsp(const graph_t& G, index_t s)
 }
 
 
+/**
+ * @brief  水準ごとに辺を並列に緩和する有向非巡回グラフの単一始点最短路
+ */
+std::pair<indices_t, array_t>  dsp(const graph_t& G, index_t s, const wavefronts& L)
+{
+    using P      = packeddist;  // 推定値と先行点を1語に詰め込む
+    using word_t = P::word_t;
+    std::int32_t n = G.size();
+
+    std::vector<word_t> D(n, P::pack(graph::inf, graph::nil));
+    D[s] = P::pack(0, graph::nil);
+    for (std::size_t k = 0; k < L.size(); k++) {  // 水準の順に、
+#pragma omp parallel for schedule(dynamic, 256)
+        for (offset_t i = L.begin(k); i < L.end(k); i++) {  // 水準kの各頂点uから出る辺を並列に緩和する
+            index_t  u  = L.order[i];
+            weight_t du = P::dist(D[u]);  // 水準kの頂点の推定値は、この水準では書き換えられない
+            if (du == graph::inf) { continue; }
+            for (const auto& e : G[u]) { write_min(&D[e.dst], P::pack(du + e.w, u), P::shorter()); }
+        }
+    }
+
+    indices_t pi(n); array_t d(n);
+    for (index_t v = 0; v < n; v++) { d[v] = P::dist(D[v]); pi[v] = P::pred(D[v]); }
+    return std::make_pair(pi, d);
+}
+
+
 
 int main(void)
 {
@@ -84,7 +115,23 @@ int main(void)
     for (int i = 0; i < n; i++) {
         std::cout << p.second[i] << std::endl;
     }
-    
+
+    // 水準ごとに並列に緩和しても、同じ最短路重みが得られる
+    auto q = dsp(G, 1, leveltsort(G));
+    std::cout << (p.second == q.second ? "ok" : "ng") << std::endl;
+
+    // 頂点数10^6のランダムな有向非巡回グラフ(負辺を含む)
+    const index_t rs = 1000000;
+    graph_t R(rs);
+    std::mt19937 mt(1);
+    std::uniform_int_distribution<weight_t> wdist(-10, 100);
+    for (index_t u = 0; u + 1 < rs; u++) {
+        std::uniform_int_distribution<index_t> vdist(u + 1, std::min(rs - 1, u + 1000));
+        for (int i = 0; i < 4; i++) { R[u].emplace_back(u, vdist(mt), wdist(mt)); }
+    }
+    wavefronts L = leveltsort(R);
+    auto a = dsp(R, 0), b = dsp(R, 0, L);
+    std::cout << L.size() << " levels " << (a.second == b.second ? "ok" : "ng") << std::endl;
 
     return 0;
 }
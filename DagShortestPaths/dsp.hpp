@@ -20,7 +20,7 @@
 //****************************************
 
 #include "../Graph/graph.hpp"
-#include "../TopologicalSort/tsort.hpp"
+#include "../Topologicalsort/tsort.hpp"
 
 
 
@@ -45,6 +45,24 @@
 std::pair<indices_t, array_t>  dsp(const graph_t& G, index_t s);
 
 
+/**
+ * @brief  水準ごとに辺を並列に緩和する有向非巡回グラフの単一始点最短路
+ *
+ * @note   トポロジカルソートの代わりに、leveltsortが求めた水準への分割Lを用いる
+ *         水準kの頂点uのu.dは、水準k - 1以下の頂点から出る辺をすべて緩和した時点で確定している. そこで、
+ *         水準の順に、1つの水準の頂点から出る辺を並列に緩和する. 同じ頂点vへの緩和は異なるストランドで競合するので、
+ *         (v.d, v.π)を1語に詰め込み、v.dだけを比べる不可分なminで更新する
+ *
+ * @note   Lは同じグラフに対して何度でも使い回せる(始点ごとにトポロジカルソートをやり直す必要はない)
+ *         仕事量はΘ(V + E)であり、スパンは水準の数に比例する
+ *
+ * @param  const graph_t&    G 重み付き有向非巡回グラフG
+ * @param  index_t           s 始点s
+ * @param  const wavefronts& L Gの水準への分割(leveltsort(G))
+ */
+std::pair<indices_t, array_t>  dsp(const graph_t& G, index_t s, const wavefronts& L);
+
+
 
 #endif  // __DSP_HPP__
 
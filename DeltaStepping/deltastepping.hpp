@@ -0,0 +1,178 @@
+/**
+ * @brief  単一始点最短路問題(single-source shortest paths problem)におけるΔ-stepping法を扱う
+ *
+ * @note   Dijkstraのアルゴリズムは最小の推定値を持つ頂点を1つずつ確定させるので本質的に逐次的であり、
+ *         Bellman-Fordのアルゴリズムはすべての辺を何度も緩和するので仕事量が多い
+ *         Δ-stepping法(Meyer and Sanders)はその中間にあたり、推定値を幅Δのバケツ
+ *           B[i] = { v ∈ V : iΔ <= v.d < (i + 1)Δ }
+ *         に分類し、添字の小さいバケツから順に、バケツ内の頂点をまとめて(並列に)処理する
+ *
+ * @date   2026/10/15
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef __DELTASTEPPING_HPP__
+#define __DELTASTEPPING_HPP__
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <omp.h>
+#include <cstdint>
+#include <algorithm>
+#include <vector>
+#include "../Graph/graph.hpp"
+#include "../Graph/atomic.hpp"
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**
+ * @brief  すべての辺重みが非負であるという仮定の下で、Δ-stepping法は重み付き有向グラフG = (V, E)上の
+ *         単一始点最短路問題をマルチスレッドで解く
+ *
+ * @note   重みがΔ以下の辺を軽い(light)辺、Δより大きい辺を重い(heavy)辺と呼ぶ. バケツB[i]の処理は次のとおりである
+ *           1. B[i]の頂点を取り出して集合Rに加え、それらから出る軽い辺を並列に緩和する
+ *              軽い辺の緩和によってB[i]に新たな頂点が入りうるので、B[i]が空になるまでこれを繰り返す
+ *           2. Rの各頂点から出る重い辺を並列に1度だけ緩和する. 重い辺の緩和で推定値が入るのはB[i + 1]以降である
+ *         B[i]が空になった時点で、B[i]に属していた頂点の推定値は最短路重みに等しい
+ *
+ * @note   緩和は不可分操作で行う. 頂点vの推定値v.dと先行点v.πを1つの64ビット語(上位32ビットがd, 下位32ビットがπ)に詰め込み、
+ *         dが真に減少する場合に限り語全体を比較交換で書き換える. したがって、dとπは常に互いに整合する
+ *         バケツは各スレッドが局所的に持ち、フロンティアを作るときに連結する. 推定値が後から減少した頂点は
+ *         古いバケツに残っているが、取り出したときにv.d / Δがバケツの添字と一致しなければ無視する
+ *
+ * @note   Δ = 1ならばDijkstraのアルゴリズム(の並列版)に、Δ = ∞ならばBellman-Fordのアルゴリズムに近づく
+ *         delta <= 0を与えた場合は、辺重みの最大値Cと平均出次数d̄からΔ = max(1, C / d̄)とする
+ *         最短路重みはdijkstraと一致する. 最短路が複数ある場合、先行点はdijkstraと異なることがある
+ *
+ * @tparam Graph グラフの表現(graph_tまたはcsrgraph)
+ * @param  const Graph&   G     非負の重み付き有向グラフG
+ * @param  index_t        s     始点s
+ * @param  weight_t       delta バケツの幅Δ
+ * @return 始点sからの最短路重みが最終的に決定された頂点の集合S
+ */
+template <class Graph>
+vertices_t deltastepping(const Graph& G, index_t s, weight_t delta = 0)
+{
+    using P       = packeddist;  // 推定値と先行点を1語に詰め込む
+    using word_t  = P::word_t;
+    using count_t = std::int64_t;
+    using bins_t  = std::vector<indices_t>;
+    std::int32_t n = G.size();
+
+    if (delta <= 0) {
+        count_t m = 0; weight_t C = 1;
+#pragma omp parallel for reduction(+:m) reduction(max:C)
+        for (index_t u = 0; u < n; u++) {
+            m += G[u].size();
+            for (const auto& e : G[u]) { C = std::max(C, e.w); }
+        }
+        delta = std::max<weight_t>(1, C / std::max<count_t>(1, m / std::max(1, n)));
+    }
+
+    std::vector<word_t> D(n, P::pack(graph::inf, graph::nil));  // 各頂点の(推定値, 先行点)
+    std::vector<count_t> stamp(n, -1);                         // 頂点が最後にRへ加えられたバケツの添字
+    std::vector<bins_t>  bins(omp_get_max_threads());         // bins[t][i] : スレッドtが持つバケツB[i]の一部
+    indices_t front, R(n);
+    count_t nr = 0;
+
+    // 辺(u, v)を緩和し、推定値が減少すればvをスレッド局所のバケツに入れる
+    auto relax = [&](const edge& e, weight_t du, bins_t& B) -> void {
+        weight_t d = du + e.w;
+        if (write_min(&D[e.dst], P::pack(d, e.src), P::shorter())) {
+            std::size_t j = d / delta;
+            if (B.size() <= j) { B.resize(j + 1); }
+            B[j].push_back(e.dst);
+        }
+    };
+    // 各スレッドが持つB[i]の部分を連結してフロンティアとし、B[i]を空にする
+    auto gather = [&](std::size_t i) -> count_t {
+        count_t size = 0, tail = 0;
+        for (auto& B : bins) { size += (i < B.size()) ? B[i].size() : 0; }
+        front.resize(size);
+#pragma omp parallel
+        {
+            bins_t& B = bins[omp_get_thread_num()];
+            if (i < B.size() && !B[i].empty()) {
+                count_t k = fetch_add(&tail, count_t(B[i].size()));
+                std::copy(B[i].begin(), B[i].end(), front.begin() + k);
+                B[i].clear();
+            }
+        }
+        return size;
+    };
+    // B[i]以降で空でない最初のバケツの添字を返す(存在しなければ-1)
+    auto nextbin = [&](std::size_t i) -> count_t {
+        count_t k = -1;
+        for (auto& B : bins) {
+            for (std::size_t j = i; j < B.size() && (k < 0 || count_t(j) < k); j++) {
+                if (!B[j].empty()) { k = j; break; }
+            }
+        }
+        return k;
+    };
+
+
+    D[s] = P::pack(0, graph::nil);
+    bins[0].resize(1); bins[0][0].push_back(s);
+    for (count_t i = nextbin(0); i >= 0; i = nextbin(i + 1)) {
+        nr = 0;
+        // B[i]が空になるまで、B[i]の頂点から出る軽い辺を緩和する
+        for (count_t nf = gather(i); nf > 0; nf = gather(i)) {
+#pragma omp parallel
+            {
+                bins_t& B = bins[omp_get_thread_num()];
+#pragma omp for schedule(dynamic, 64)
+                for (count_t k = 0; k < nf; k++) {
+                    index_t  u  = front[k];
+                    weight_t du = P::dist(atomic_load(&D[u]));
+                    if (du / delta != i) { continue; }  // 古い項目は無視する
+                    count_t  old = atomic_load(&stamp[u]);
+                    if (old != i && cas(&stamp[u], old, i)) { R[fetch_add(&nr, count_t(1))] = u; }
+                    for (const auto& e : G[u]) {
+                        if (e.w <= delta) { relax(e, du, B); }
+                    }
+                }
+            }
+        }
+        // B[i]に属していた頂点から出る重い辺を1度だけ緩和する
+#pragma omp parallel
+        {
+            bins_t& B = bins[omp_get_thread_num()];
+#pragma omp for schedule(dynamic, 64)
+            for (count_t k = 0; k < nr; k++) {
+                index_t  u  = R[k];
+                weight_t du = P::dist(D[u]);
+                for (const auto& e : G[u]) {
+                    if (e.w > delta) { relax(e, du, B); }
+                }
+            }
+        }
+    }
+
+
+    vertices_t S(n);
+#pragma omp parallel for
+    for (index_t v = 0; v < n; v++) {
+        S[v].d     = P::dist(D[v]);
+        S[v].pi    = P::pred(D[v]);
+        S[v].color = (S[v].d != graph::inf) ? color::black : color::white;
+    }
+    return S;
+}
+
+
+
+#endif  // end of __DELTASTEPPING_HPP__
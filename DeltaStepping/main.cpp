@@ -0,0 +1,65 @@
+/**
+ * @brief  Δ-stepping法の動作確認
+ * @date   2026/10/15
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include "deltastepping.hpp"
+#include "../Dijkstra/dijkstra.hpp"
+#include "../Graph/csr.hpp"
+
+
+
+int main(void)
+{
+    using namespace std;
+
+    // 演習問題(CLRS 図24.6)のグラフ
+    const int vs = 5;
+    graph_t G(vs);
+    G[0] = { edge(0, 1, 10), edge(0, 3, 5) };
+    G[1] = { edge(1, 2, 1), edge(1, 3, 2) };
+    G[2] = { edge(2, 4, 4) };
+    G[3] = { edge(3, 1, 3), edge(3, 2, 9), edge(3, 4, 2) };
+    G[4] = { edge(4, 0, 7), edge(4, 2, 6) };
+    for (weight_t delta : { 1, 3, 100 }) {
+        auto S = deltastepping(G, 0, delta);
+        cout << "delta = " << delta << " :";
+        for (auto& v : S) { cout << " " << v.d; }
+        cout << endl;
+    }
+
+    // ランダムグラフ上でdijkstraと最短路重みを比較する
+    const int n = 1 << 20, m = 1 << 23;
+    mt19937 mt(1);
+    uniform_int_distribution<index_t>  vdist(0, n - 1);
+    uniform_int_distribution<weight_t> wdist(1, 1000);
+    edges_t E; E.reserve(m);
+    for (int i = 0; i < m; i++) { E.emplace_back(vdist(mt), vdist(mt), wdist(mt)); }
+    csrgraph C(n, E);
+
+    auto start    = chrono::steady_clock::now();
+    auto expected = dijkstra(C, 0);
+    auto middle   = chrono::steady_clock::now();
+    auto actual   = deltastepping(C, 0);
+    auto stop     = chrono::steady_clock::now();
+
+    bool ok = true;
+    for (int v = 0; v < n; v++) {
+        ok = ok && expected[v].d == actual[v].d;
+        ok = ok && (v == 0 || actual[v].d == graph::inf || actual[actual[v].pi].d <= actual[v].d);
+    }
+    cout << "dijkstra      : " << chrono::duration<double, milli>(middle - start).count() << " ms" << endl;
+    cout << "deltastepping : " << chrono::duration<double, milli>(stop - middle).count()  << " ms" << endl;
+    cout << (ok ? "ok" : "ng") << endl;
+
+    return 0;
+}
@@ -0,0 +1,123 @@
+/**
+ * @brief  Dijkstraのアルゴリズムにおける優先度付きキューの方策を比較するベンチマーク
+ *
+ * @note   添字付き4分ヒープ(dheap_policy), 2分ヒープ(binheap_policy), 基数ヒープ(radixheap_policy), バケツキュー(bucketqueue_policy)の4つについて、
+ *         辺重みの最大値Cを変えた疎なランダムグラフと格子グラフ上で実行時間を測定する
+ *         すべての方策で最短路重みが一致することも確かめる
+ *         dheap(S)は既定の方策で、vertices_tに変換せずに使い回すvertexstateへ書き込む場合である
+ *
+ * @date   2026/10/15
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include "dijkstra.hpp"
+#include "../Graph/csr.hpp"
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**
+ * @brief  n頂点m辺のランダムな有向グラフを生成する. 辺重みは[1, C]の一様乱数とする
+ */
+csrgraph randomgraph(std::int32_t n, std::int64_t m, weight_t C, std::mt19937& mt)
+{
+    std::uniform_int_distribution<index_t>  vdist(0, n - 1);
+    std::uniform_int_distribution<weight_t> wdist(1, C);
+    edges_t E; E.reserve(m);
+    for (std::int64_t i = 0; i < m; i++) {
+        index_t u = vdist(mt), v = vdist(mt);
+        E.emplace_back(u, v, wdist(mt));
+    }
+    return csrgraph(n, E);
+}
+
+
+/**
+ * @brief  k×kの格子グラフ(道路網に近い、直径の大きいグラフ)を生成する. 辺重みは[1, C]の一様乱数とする
+ */
+csrgraph gridgraph(std::int32_t k, weight_t C, std::mt19937& mt)
+{
+    std::uniform_int_distribution<weight_t> wdist(1, C);
+    edges_t E;
+    for (index_t i = 0; i < k; i++) {
+        for (index_t j = 0; j < k; j++) {
+            index_t u = i * k + j;
+            if (j + 1 < k) { E.emplace_back(u, u + 1, wdist(mt)); E.emplace_back(u + 1, u, wdist(mt)); }
+            if (i + 1 < k) { E.emplace_back(u, u + k, wdist(mt)); E.emplace_back(u + k, u, wdist(mt)); }
+        }
+    }
+    return csrgraph(k * k, E);
+}
+
+
+/**
+ * @brief  方策Queueを用いたDijkstraのアルゴリズムの実行時間[ms]を測定する
+ */
+template <class Queue>
+double measure(const csrgraph& G, vertices_t& S)
+{
+    auto start = std::chrono::steady_clock::now();
+    S = dijkstra<Queue>(G, 0);
+    auto stop  = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+
+/**
+ * @brief  既定の方策で、使い回す頂点の状態Sに書き込むDijkstraのアルゴリズムの実行時間[ms]を測定する
+ */
+double measure(const csrgraph& G, vertexstate& S)
+{
+    auto start = std::chrono::steady_clock::now();
+    dijkstra(G, 0, S);
+    auto stop  = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+
+/**
+ * @brief  4つの方策の実行時間を1行に出力する
+ */
+void run(const std::string& name, const csrgraph& G, weight_t C)
+{
+    vertices_t S0, S1, S2, S3;
+    double t0 = measure<binheap_policy>(G, S0);
+    double t1 = measure<radixheap_policy>(G, S1);
+    double t2 = measure<bucketqueue_policy>(G, S2);
+    double t3 = measure<dheap_policy>(G, S3);
+    vertexstate S4(G.size()); measure(G, S4);  // 2回目以降の始点と同じく、確保済みのSに書き込む
+    double t4 = measure(G, S4);
+    bool ok = true;
+    for (std::size_t v = 0; v < G.size(); v++) {
+        ok = ok && S0[v].d == S1[v].d && S0[v].d == S2[v].d && S0[v].d == S3[v].d && S0[v].d == S4.d[v];
+    }
+    std::printf("%-8s %9zu %10zu %8d %10.2f %10.2f %10.2f %10.2f %10.2f  %s\n",
+                name.c_str(), G.size(), G.edges(), C, t4, t3, t0, t1, t2, ok ? "ok" : "ng");
+}
+
+
+
+int main(void)
+{
+    std::mt19937 mt(1);
+    std::printf("%-8s %9s %10s %8s %10s %10s %10s %10s %10s\n", "graph", "V", "E", "C", "dheap(S)", "dheap", "binheap", "radixheap", "bucket");
+    for (weight_t C : { 1, 16, 256, 65536 }) {
+        run("random", randomgraph(1 << 18, 1 << 21, C, mt), C);
+    }
+    for (weight_t C : { 1, 16, 256, 65536 }) {
+        run("grid", gridgraph(1 << 9, C, mt), C);
+    }
+    return 0;
+}
@@ -19,12 +19,110 @@
 // 必要なヘッダファイルのインクルード
 //****************************************
 
+#include <utility>
 #include "../Graph/graph.hpp"
+#include "../Graph/vertexstate.hpp"
+#include "../Graph/visitor.hpp"
+#include "../PriorityQueue/pqueue.hpp"
+#include "../PriorityQueue/dheap.hpp"
+#include "../PriorityQueue/radixheap.hpp"
+#include "../PriorityQueue/bucketqueue.hpp"
 
 
 
 //****************************************
-// 関数プロトタイプ
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief  Dijkstraのアルゴリズムで用いるmin優先度付きキューQの方策(policy)
+ *
+ * @note   各方策はグラフGから構築され、次の操作を持つ
+ *           push(v, d) : 頂点vを最短路推定値dで挿入する(vがすでにQに含まれていてもよい)
+ *           pop()      : 最小の推定値を持つ(頂点, 推定値)の対を削除して返す
+ *           empty()    : Qが空かどうかを返す
+ *         popが返す推定値が頂点の現在のd値より大きい場合、その対は古い(stale)ものとして無視される
+ *
+ * @note   dheap_policy       : 添字付き4分ヒープ. 任意の非負重みで使える. 各頂点は高々1度しかQに含まれず、pushはDECREASE-KEYになるので、
+ *                              Qの大きさは高々|V|であり、全体でΟ(ElgV)時間. 古い対は生じない
+ *         binheap_policy     : 2分ヒープ. 任意の非負重みで使える. 挿入はΟ(E)回であり、全体でΟ(ElgV)時間
+ *         radixheap_policy   : 基数ヒープ. 整数重みに限る. 全体でΟ(E + VlgC)時間(Cは辺重みの最大値)
+ *         bucketqueue_policy : Dialのバケツキュー. 小さな整数重みに限る. 全体でΟ(E + VC)時間、記憶量はΘ(V + C)
+ */
+struct dheap_policy {
+    using pair_t = std::pair<index_t, weight_t>;
+    dheap<weight_t> Q;
+
+    template <class Graph>
+    explicit dheap_policy(const Graph& G) : Q(G.size()) {}
+
+    void   push(index_t v, weight_t d) { Q.push(v, d); }  // vがQに含まれていれば、そのキーを減少させる
+    pair_t pop()                       { return Q.extract(); }
+    bool   empty()                     { return Q.empty(); }
+};
+
+struct binheap_policy {
+    using pair_t = std::pair<index_t, weight_t>;
+    struct cmp { bool operator () (const pair_t& p, const pair_t& q) { return p.second > q.second; } };
+    pqueue<pair_t, cmp> Q;
+
+    template <class Graph>
+    explicit binheap_policy(const Graph& G) : Q(capacity(G)) {}
+
+    void   push(index_t v, weight_t d) { Q.insert(std::make_pair(v, d)); }
+    pair_t pop()                       { return Q.extract(); }
+    bool   empty()                     { return Q.empty(); }
+
+    /**< @brief 挿入の回数は高々|E| + 1なので、ヒープの大きさをそれに合わせる */
+    template <class Graph>
+    static std::size_t capacity(const Graph& G)
+    {
+        std::int32_t n = G.size();
+        std::size_t m = 1; for (index_t u = 0; u < n; u++) { m += G[u].size(); }
+        return m;
+    }
+};
+
+struct radixheap_policy {
+    using pair_t = std::pair<index_t, weight_t>;
+    radixheap<index_t> Q;
+
+    template <class Graph>
+    explicit radixheap_policy(const Graph&) {}
+
+    void   push(index_t v, weight_t d) { Q.insert(d, v); }
+    pair_t pop()                       { auto p = Q.extract(); return std::make_pair(p.second, weight_t(p.first)); }
+    bool   empty()                     { return Q.empty(); }
+};
+
+struct bucketqueue_policy {
+    using pair_t = std::pair<index_t, weight_t>;
+    bucketqueue Q;
+
+    template <class Graph>
+    explicit bucketqueue_policy(const Graph& G) : Q(G.size(), maxweight(G)) {}
+
+    void   push(index_t v, weight_t d) { Q.insert(v, d); }  // vがQに含まれていれば、そのキーを減少させる
+    pair_t pop()                       { return Q.extract(); }
+    bool   empty()                     { return Q.empty(); }
+
+    /**< @brief 辺重みの最大値Cを返す. バケツの数はC + 1である */
+    template <class Graph>
+    static weight_t maxweight(const Graph& G)
+    {
+        std::int32_t n = G.size();
+        weight_t C = 0;
+        for (index_t u = 0; u < n; u++) {
+            for (const auto& e : G[u]) { C = e.w > C ? e.w : C; }
+        }
+        return C;
+    }
+};
+
+
+
+//****************************************
+// 関数の定義
 //****************************************
 
 /**
@@ -32,17 +130,110 @@
  *         重み付き有向グラフG = (V, E)上の単一始点最短路問題を解く. ここでは各辺(u, v) ∈ Eについてw(u, v) >= 0を仮定する
  *
  * @note   Dijkstraのアルゴリズムは、始点sからの最短路重みが最終的に決定された頂点の集合Sを管理する
- *         アルゴリズムは、繰り返し、最小の最短路推定値を持つ頂点u ∈ V - Sを選択し、uをSに追加し、
+ *         アルゴリズムは繰り返し、最小の最短路推定値を持つ頂点u ∈ V - Sを選択し、uをSに追加し、
  *         uから出るすべての辺を緩和する. ここではd値をキーとする頂点のmin優先度付きキューQを用いる
  *
- * @note   優先度付きキューの優先度更新を行わないため、優先度付きキューが空になるまでに行われる挿入の数はΟ(E)であるが、
+ * @note   既定のdheap_policyでは、緩和によってv.dが減少したときにQ上のvのキーを減少させる(DECREASE-KEY)ので、Qの大きさは高々|V|である
+ *         優先度更新を行わない方策(binheap_policyなど)では、優先度付きキューが空になるまでに行われる挿入の数はΟ(E)であるが、
  *         EXTRACT-MIN呼び出し時に、最短路の更新が行われないならば、無視をすることで、全体としての実行時間をΟ(ElgV)としている
  *
- * @param  const graph_t& G    非負の重み付き有向グラフG
+ * @note   辺重みが整数であれば、Queueにradixheap_policyまたはbucketqueue_policyを指定することで、
+ *         比較に基づかない単調な優先度付きキューを用いることができる. 例えば、dijkstra<radixheap_policy>(G, s)のように呼び出す
+ *
+ * @note   頂点の属性は属性ごとの配列からなるvertexstateに書き込む(Graph/vertexstate.hpp). 緩和が読むのはdと色の配列だけなので、
+ *         vertices_tに比べて1本のキャッシュ行に載る頂点が多い. 同じSを始点ごとに渡せば、頂点の属性の確保は1度で済む
+ *
+ * @note   探索の各事象で訪問者visの同名のメンバ関数を呼び出す(Graph/visitor.hpp)
+ *
+ * @tparam Queue   優先度付きキューの方策(既定は添字付き4分ヒープ)
+ * @tparam Graph   グラフの表現(graph_tまたはcsrgraph)
+ * @tparam Visitor 訪問者の型(nullvisitorを継承したもの)
+ * @param  const Graph&   G    非負の重み付き有向グラフG
  * @param  index_t        s    始点s
+ * @param  vertexstate&   S    始点sからの最短路重みが最終的に決定された頂点の集合S(初期化して上書きする)
+ * @param  Visitor&&      vis  訪問者
+ */
+template <class Queue = dheap_policy, class Graph, class Visitor>
+void dijkstra(const Graph& G, index_t s, vertexstate& S, Visitor&& vis)
+{
+    using pair_t = std::pair<index_t, weight_t>;        
+    std::int32_t n = G.size();
+    Queue Q(G);
+
+    // Θ(V)の手続きによって最短経路推定値と先行点を初期化する
+    auto initsinglesource = [&vis](vertexstate& S, index_t s, std::int32_t n) -> void {
+        S.reset(n);
+        for (index_t v = 0; v < n; v++) { vis.initialize_vertex(v); }
+        S.d[s] = 0; S.paint(s, color::gray);
+        vis.discover_vertex(s);
+    };
+    // 辺(u, v)の緩和(relaxing)はuを経由することでvへの既知の最短路が改善できるか否かを判定し、改善できるならばv.dとv.πを更新する
+    // 緩和によって最短路推定値v.dが減少し、vの先行点属性v.πが更新されることがある. 以下のコードは、辺(u, v)上の緩和をΟ(1)時間で実行する
+    auto relax = [&vis](const edge& e, weight_t du, vertexstate& S, Queue& Q) ->void {
+        index_t v = e.dst, u = e.src;
+        if (S.d[v] > du + e.w && S.colorof(v) != color::black) {
+            if (S.colorof(v) == color::white) { vis.discover_vertex(v); }
+            S.d[v] = du + e.w; S.pi[v] = u; S.paint(v, color::gray);
+            Q.push(v, S.d[v]); 
+            vis.edge_relaxed(e);
+        }
+        else {
+            vis.edge_not_relaxed(e);
+        }
+    };
+
+
+    
+    initsinglesource(S, s, n);               // すべての頂点のd値とπ値を初期化する
+    Q.push(s, S.d[s]);  // このループの最初の実行ではu = sである
+    while (!Q.empty()) {
+        pair_t  p = Q.pop();
+        index_t u = p.first; weight_t d = p.second;
+        if (S.colorof(u) == color::black || S.d[u] < d) { continue; }  // 古い対は無視する
+        vis.examine_vertex(u);
+        for (const auto& e : G[u]) {  // 頂点uからでる辺(u, v)をそれぞれ緩和し、
+            vis.examine_edge(e);
+            relax(e, d, S, Q);     // uを経由することでvへの最短路が改善できる場合には、推定値v.dと先行点v.piを更新する
+        }
+        S.paint(u, color::black);  // 黒頂点は集合Sに属す
+        vis.finish_vertex(u);
+    }
+    // 終了時点ではQ = φである. S = Vなので、すべての頂点u ∈ Vに対してu.d = δ(s, u)である
+    // また、このとき、先行点部分グラフGπはsを根とする最短路木である
+}
+
+
+/**
+ * @brief  Dijkstraのアルゴリズム(頂点の状態に書き込み、事象を受け取らない)
+ */
+template <class Queue = dheap_policy, class Graph>
+void dijkstra(const Graph& G, index_t s, vertexstate& S)
+{
+    dijkstra<Queue>(G, s, S, nullvisitor());
+}
+
+
+/**
+ * @brief  Dijkstraのアルゴリズム(頂点集合を返す)
  * @return 始点sからの最短路重みが最終的に決定された頂点の集合S
  */
-vertices_t dijkstra(const graph_t& G, index_t s);
+template <class Queue = dheap_policy, class Graph, class Visitor>
+vertices_t dijkstra(const Graph& G, index_t s, Visitor&& vis)
+{
+    vertexstate S;
+    dijkstra<Queue>(G, s, S, vis);
+    return S.tovertices();
+}
+
+
+/**
+ * @brief  Dijkstraのアルゴリズム(頂点集合を返し、事象を受け取らない)
+ */
+template <class Queue = dheap_policy, class Graph>
+vertices_t dijkstra(const Graph& G, index_t s)
+{
+    return dijkstra<Queue>(G, s, nullvisitor());
+}
 
 
 
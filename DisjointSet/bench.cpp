@@ -0,0 +1,107 @@
+/**
+ * @brief  素集合森(disjointset)と並行素集合森(concurrentdisjointset)を比較するベンチマーク
+ *
+ * @note   n個の節点にランダムな合併をm回行い、続けてm回の問い合わせ(2節点が同じ集合に属するか)を行う
+ *         disjointsetは1スレッドで、concurrentdisjointsetはスレッド数を変えて、それぞれの実行時間を測定する
+ *         最後に、どちらも同じ分割(集合の族)を表していることを確かめる
+ *
+ * @date   2026/10/15
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <utility>
+#include <vector>
+#include <omp.h>
+#include "disjointset.hpp"
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+using pairs_t = std::vector<std::pair<std::int32_t, std::int32_t>>;
+
+
+/**
+ * @brief  [0, n)の節点の組をm個、一様乱数で生成する
+ */
+pairs_t randompairs(std::int32_t n, std::int64_t m, std::mt19937& mt)
+{
+    std::uniform_int_distribution<std::int32_t> dist(0, n - 1);
+    pairs_t P(m);
+    for (auto& p : P) { p.first = dist(mt); p.second = dist(mt); }
+    return P;
+}
+
+
+/**
+ * @brief  素集合森dsとcdsが同じ分割を表すか否かを返す
+ * @note   dsの各代表元に対応するcdsの代表元がただ1つに定まり、集合の数が等しければ同じ分割である
+ */
+bool same(disjointset& ds, concurrentdisjointset& cds, std::int32_t n)
+{
+    std::vector<std::int32_t> m(n, -1);
+    std::int32_t sets = 0, csets = 0;
+    for (std::int32_t x = 0; x < n; x++) {
+        std::int32_t r = ds.findset(x), c = cds.findset(x);
+        if (m[r] == -1) { m[r] = c; }
+        if (m[r] != c) { return false; }
+        sets  += (r == x);
+        csets += (c == x);
+    }
+    return sets == csets;
+}
+
+
+
+int main(void)
+{
+    using namespace std::chrono;
+    const std::int32_t n = 1 << 22;
+    std::mt19937 mt(1);
+
+    std::printf("%10s %10s %8s %12s %12s  %s\n", "n", "m", "threads", "merge[ms]", "find[ms]", "");
+    for (std::int64_t m : { std::int64_t(n) / 2, std::int64_t(n), std::int64_t(n) * 4 }) {
+        pairs_t M = randompairs(n, m, mt), Q = randompairs(n, m, mt);
+        std::vector<char> r0(m), r1(m);
+
+        // 逐次版
+        disjointset ds(n);
+        for (std::int32_t x = 0; x < n; x++) { ds.makeset(x); }
+        auto t0 = steady_clock::now();
+        for (auto& p : M) { if (ds.findset(p.first) != ds.findset(p.second)) { ds.merge(p.first, p.second); } }
+        auto t1 = steady_clock::now();
+        for (std::int64_t i = 0; i < m; i++) { r0[i] = ds.findset(Q[i].first) == ds.findset(Q[i].second); }
+        auto t2 = steady_clock::now();
+        std::printf("%10d %10ld %8s %12.2f %12.2f\n", n, long(m), "seq",
+                    duration<double, std::milli>(t1 - t0).count(), duration<double, std::milli>(t2 - t1).count());
+
+        // 並行版
+        for (int threads = 1; threads <= omp_get_max_threads(); threads *= 2) {
+            concurrentdisjointset cds(n);
+#pragma omp parallel for num_threads(threads)
+            for (std::int32_t x = 0; x < n; x++) { cds.makeset(x); }
+            auto t0 = steady_clock::now();
+#pragma omp parallel for num_threads(threads)
+            for (std::int64_t i = 0; i < m; i++) { cds.merge(M[i].first, M[i].second); }
+            auto t1 = steady_clock::now();
+#pragma omp parallel for num_threads(threads)
+            for (std::int64_t i = 0; i < m; i++) { r1[i] = cds.findset(Q[i].first) == cds.findset(Q[i].second); }
+            auto t2 = steady_clock::now();
+            bool ok = r0 == r1 && same(ds, cds, n);
+            std::printf("%10d %10ld %8d %12.2f %12.2f  %s\n", n, long(m), threads,
+                        duration<double, std::milli>(t1 - t0).count(), duration<double, std::milli>(t2 - t1).count(),
+                        ok ? "ok" : "ng");
+        }
+    }
+    return 0;
+}
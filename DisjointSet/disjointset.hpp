@@ -21,6 +21,8 @@
 
 #include <vector>
 #include <cstdint>
+#include <utility>
+#include "../Graph/atomic.hpp"
 
 
 
@@ -101,6 +103,80 @@ struct disjointset {
 };
 
 
+/**
+ * @brief 複数のストランドから同時に操作できる素集合森
+ *
+ * @note  disjointsetは親pとランクrankを別々の配列に持ち、findsetで経路を書き換えるので、ストランド間で共有できない
+ *        ここでは、各節点の親とランクを1語(下位32ビットに親、上位32ビットにランク)に詰め込み、
+ *        語全体を比較交換(CAS)で書き換える. 親とランクは常に同時に読み書きされるので、両者が食い違うことはない
+ *
+ * @note  findsetは経路半減(path halving)を行う. 根に向かう途中で、各節点の親を祖父に付け替えることを1度だけ試み、
+ *        CASが失敗しても(他のストランドがすでに経路を短くしているので)やり直さずに先へ進む. 従って、findsetは
+ *        他のストランドの進行に依存せず有限の手順で終わる(wait-free)
+ *
+ * @note  mergeは、(ランク, 添字)の辞書式順序で小さい根xを大きい根yの子にする. xの語がまだ根xを表していることを
+ *        CASで確かめながら付け替え、失敗すれば代表元を求め直してやり直す. 根の(ランク, 添字)は時間とともに
+ *        増加するだけなので、どの経路上でも(ランク, 添字)は真に増加し、閉路は生じない
+ */
+struct concurrentdisjointset {
+    using index_t = std::int32_t;
+    using word_t  = std::uint64_t;
+
+    std::vector<word_t> a;  /**< 各節点の親とランクを詰め込んだ語 */
+
+    explicit concurrentdisjointset(std::size_t size) : a(size, pack(-1, -1)) {}
+
+    /**
+     * @brief xを唯一の要素としてもつ新しい集合を生成する
+     * @note  他のストランドがxを含む集合を操作していないときに呼び出すこと
+     */
+    void makeset(index_t x) {
+        atomic_store(&a[x], pack(x, 0));
+    }
+
+    /**
+     * @brief  xを含む動的集合Sxとyを含む動的集合Syを合併する
+     * @note   SxとSyがすでに同じ集合である場合は何もしない
+     * @return 実際に2つの集合を合併したか否か(同時に同じ2集合を合併しようとしたストランドのうち、1つだけがtrueを得る)
+     */
+    bool merge(index_t x, index_t y) {
+        while (true) {
+            x = findset(x); y = findset(y);
+            if (x == y) { return false; }
+            word_t wx = atomic_load(&a[x]), wy = atomic_load(&a[y]);
+            if (parent(wx) != x || parent(wy) != y) { continue; }  // 読み出す間に根でなくなった
+            if (rank(wx) > rank(wy) || (rank(wx) == rank(wy) && x > y)) { std::swap(x, y); std::swap(wx, wy); }
+            if (!cas(&a[x], wx, pack(y, rank(wx)))) { continue; }  // xの親はyを指す
+            if (rank(wx) == rank(wy)) {  // y.rankをひとつ増やす(yがすでに根でなくなっていれば増やさない)
+                cas(&a[y], wy, pack(y, rank(wy) + 1));
+            }
+            return true;
+        }
+    }
+
+    /**
+     * @brief  xを含む集合の代表元を返す
+     * @note   返した代表元は、findsetを実行している間のある時点で根であった節点である
+     */
+    index_t findset(index_t x) {
+        while (true) {
+            word_t  w = atomic_load(&a[x]);
+            index_t p = parent(w);
+            if (p == x) { return x; }
+            index_t g = parent(atomic_load(&a[p]));
+            if (g == p) { return p; }
+            cas(&a[x], w, pack(g, rank(w)));  // xの親を祖父に付け替え、祖父へ進む(経路半減)
+            x = g;
+        }
+    }
+
+private:
+    static word_t  pack(index_t p, index_t r) { return (word_t(std::uint32_t(r)) << 32) | std::uint32_t(p); }
+    static index_t parent(word_t w) { return index_t(std::uint32_t(w)); }
+    static index_t rank(word_t w)   { return index_t(w >> 32); }
+};
+
+
 
 #endif  // end of __DISJOINTSET_H__
 
@@ -0,0 +1,210 @@
+/**
+ * @brief  辺の更新の下で単一始点最短路を保守する動的単一始点最短路(dynamic single-source shortest paths)を扱う
+ *
+ * @note   辺の重みが少しだけ変化するたびにdijkstraを始めから実行し直すと、変化の大きさによらずΟ(ElgV)時間かかる
+ *         ここではRamalingam-Repsの方法にしたがい、変化によって最短路重みが変わりうる頂点(影響を受ける頂点)だけを修復する
+ *         修復の実行時間は、影響を受けた頂点の数とそれらに接続する辺の数に比例する
+ *
+ * @date   2026/10/15
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef __DYNAMICSSSP_HPP__
+#define __DYNAMICSSSP_HPP__
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <cassert>
+#include <cstdint>
+#include <vector>
+#include "../Graph/graph.hpp"
+#include "../Graph/vertexstate.hpp"
+#include "../PriorityQueue/dheap.hpp"
+#include "../Dijkstra/dijkstra.hpp"
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief  動的単一始点最短路
+ *
+ * @note   非負の重み付き有向グラフG = (V, E)と始点sについて、最短路重みu.dと最短路木の先行点u.πを保持する
+ *         辺の更新は辺(u, v, w)の列(バッチ)で与え、各辺について「辺(u, v)の重みをwにする」ことを表す
+ *           (u, v)がGに含まれなければ挿入、w = ∞ならば削除、それ以外は重みの変更である
+ *         各順序対(u, v)について辺は高々1本とする(構築時の多重辺は、最短路に関係する最小の重みの辺だけを残す)
+ *
+ * @note   バッチの処理は次の3段階からなる. バッチの辺をすべてGに反映してから行うので、同じ辺が何度現れても最後の重みだけが効く
+ *           1. 削除・増加 : 最短路木の辺(u.π = uである辺(u, v))が削除されたかu.d + w(u, v) > v.dとなったならば、
+ *                           vを根とする部分木の頂点はすべて影響を受ける. それらの推定値を∞に戻し、影響を受けない入辺の始点xから
+ *                           v.d = min(x.d + w(x, v))と推定値を付け直して、有限ならばmin優先度付きキューQに入れる
+ *           2. 挿入・減少 : u.d + w(u, v) < v.dとなった辺(u, v)を緩和し、vをQに入れる
+ *           3. 伝播       : Qが空になるまでDijkstraのアルゴリズムと同じく最小の推定値を持つ頂点を取り出し、その出辺を緩和する
+ *         影響を受けない頂点の推定値は、更新によって重みの変わらない最短路木上の道の重みなので、すべての推定値は真の最短路重み以上である
+ *         三角不等式v.d <= u.d + w(u, v)を破りうる辺は、始点がQに入った辺か段階2で緩和した辺だけなので、
+ *         段階3が終わればすべての辺で三角不等式が成り立ち、推定値は新しいグラフの最短路重みに一致する
+ *
+ * @note   最短路が複数ある頂点では、先行点がdijkstraを始めから実行した場合と異なることがある(最短路重みは一致する)
+ *         構築はΟ(V + E)時間である. バッチの辺(u, v)の検索はuの隣接リストとvの入辺のリストの走査なので、
+ *         1辺の更新にΟ(outdeg(u) + indeg(v))時間かかる
+ */
+struct dynamicsssp {
+    graph_t     Adj;       /**< 隣接リスト(Adj[u]は辺(u, v)の列) */
+    graph_t     RAdj;      /**< 入辺のリスト(RAdj[v]は辺(u, v)の列) */
+    index_t     s;         /**< 始点s */
+    vertexstate S;         /**< 最短路重みと最短路木(到達できる頂点は黒、到達できない頂点は白) */
+    dheap<weight_t> Q;     /**< 修復に用いるmin優先度付きキュー */
+    std::vector<std::uint8_t> affected;  /**< 段階1で影響を受けたか否か */
+    std::int64_t updated;  /**< 直前のバッチで推定値を付け直した回数(修復の仕事量の目安) */
+
+    /**
+     * @brief  グラフGと始点sからdijkstraを実行して構築する
+     * @tparam Graph グラフの表現(graph_tまたはcsrgraph)
+     */
+    template <class Graph>
+    dynamicsssp(const Graph& G, index_t s) : dynamicsssp(G, s, dijkstra(G, s)) {}
+
+    /**
+     * @brief  グラフGと始点s、およびdijkstra(G, s)の結果Vから構築する
+     * @note   各頂点uの隣接リストを走査する間、終点vごとに「最後にvを終点とした始点」と「その辺の位置」を記録し、
+     *         多重辺は最小の重みの1本にまとめる. 入辺のリストは入次数を数えてから1回の走査で作るので、Ο(V + E)時間である
+     * @tparam Graph グラフの表現(graph_tまたはcsrgraph)
+     */
+    template <class Graph>
+    dynamicsssp(const Graph& G, index_t s, const vertices_t& V)
+        : Adj(G.size()), RAdj(G.size()), s(s), S(V), Q(G.size()), affected(G.size(), 0), updated(0)
+    {
+        std::int32_t n = G.size();
+        indices_t last(n, graph::nil);  // last[v] == uならば、Adj[u]にはすでに辺(u, v)がある
+        indices_t pos(n);               // その辺のAdj[u]での位置
+        indices_t indeg(n, 0);
+        for (index_t u = 0; u < n; u++) {
+            for (const auto& e : G[u]) {
+                index_t v = e.dst;
+                if (e.w >= graph::inf) { continue; }
+                if (last[v] != u) { last[v] = u; pos[v] = Adj[u].size(); Adj[u].emplace_back(u, v, e.w); indeg[v]++; }
+                else if (e.w < Adj[u][pos[v]].w) { Adj[u][pos[v]].w = e.w; }  // 多重辺は最小の重みだけを残す
+            }
+        }
+        for (index_t v = 0; v < n; v++) { RAdj[v].reserve(indeg[v]); }
+        for (index_t u = 0; u < n; u++) {
+            for (const auto& e : Adj[u]) { RAdj[e.dst].push_back(e); }
+        }
+    }
+
+    /**< @brief 頂点の数を返す */
+    std::size_t size() const { return Adj.size(); }
+
+    /**< @brief 辺(u, v)の重みを返す(辺がなければ∞) */
+    weight_t weight(index_t u, index_t v) const
+    {
+        for (const auto& e : Adj[u]) { if (e.dst == v) { return e.w; } }
+        return graph::inf;
+    }
+
+    /**< @brief 現在の最短路重みと最短路木を頂点集合として返す */
+    vertices_t tovertices() const { return S.tovertices(); }
+
+    /**
+     * @brief  辺(u, v)の重みをwにする(w = ∞ならば削除する)
+     */
+    void update(index_t u, index_t v, weight_t w)
+    {
+        update(edges_t{ edge(u, v, w) });
+    }
+
+    /**
+     * @brief  辺の更新のバッチBを反映し、最短路重みと最短路木を修復する
+     * @param  const edges_t& B 各辺(u, v, w)は辺(u, v)の重みをwにすることを表す(w = ∞ならば削除)
+     */
+    void update(const edges_t& B)
+    {
+        std::int32_t n = size();
+        updated = 0;
+        for (const auto& e : B) {
+            assert(0 <= e.src && e.src < n && 0 <= e.dst && e.dst < n && e.w >= 0);
+            link(e.src, e.dst, e.w);
+        }
+
+        // 1. 最短路木の辺が削除されたか重くなった頂点vを根とする部分木の頂点を集める
+        indices_t A;
+        for (const auto& e : B) {
+            index_t u = e.src, v = e.dst;
+            if (S.pi[v] != u || affected[v]) { continue; }
+            weight_t w = weight(u, v);
+            if (w == graph::inf || S.d[u] + w > S.d[v]) {
+                affected[v] = 1; A.push_back(v);
+            }
+        }
+        for (std::size_t i = 0; i < A.size(); i++) {  // Aの未処理の部分をFIFOキューとして、最短路木の子をたどる
+            index_t x = A[i];
+            for (const auto& e : Adj[x]) {
+                if (S.pi[e.dst] == x && !affected[e.dst]) { affected[e.dst] = 1; A.push_back(e.dst); }
+            }
+        }
+        for (auto v : A) { S.d[v] = graph::inf; S.pi[v] = graph::nil; S.paint(v, color::white); }
+        for (auto v : A) {  // 影響を受けない入辺の始点から推定値を付け直す
+            for (const auto& e : RAdj[v]) {
+                index_t x = e.src;
+                if (!affected[x] && S.d[x] != graph::inf && S.d[x] + e.w < S.d[v]) { S.d[v] = S.d[x] + e.w; S.pi[v] = x; }
+            }
+            if (S.d[v] != graph::inf) { S.paint(v, color::black); Q.push(v, S.d[v]); updated++; }
+        }
+        for (auto v : A) { affected[v] = 0; }
+
+        // 2. 軽くなった辺と挿入された辺を緩和する
+        for (const auto& e : B) {
+            index_t u = e.src, v = e.dst;
+            weight_t w = weight(u, v);
+            if (w != graph::inf && S.d[u] != graph::inf) { relax(u, v, w); }
+        }
+
+        // 3. 推定値の変化をDijkstraのアルゴリズムと同じ順序で伝播する
+        while (!Q.empty()) {
+            index_t u = Q.extract().first;
+            for (const auto& e : Adj[u]) { relax(u, e.dst, e.w); }
+        }
+    }
+
+private:
+    /**
+     * @brief  辺(u, v)の重みをwにする(辺がなければ挿入し、w = ∞ならば削除する)
+     * @note   削除では、リストの末尾の辺を空いた位置に移す
+     */
+    void link(index_t u, index_t v, weight_t w)
+    {
+        auto set = [w](edges_t& L, std::size_t i) {
+            if (w == graph::inf) { L[i] = L.back(); L.pop_back(); }
+            else                 { L[i].w = w; }
+        };
+        std::size_t i = 0, j = 0;
+        while (i < Adj[u].size() && Adj[u][i].dst != v) { i++; }
+        while (j < RAdj[v].size() && RAdj[v][j].src != u) { j++; }
+        if (i < Adj[u].size()) { set(Adj[u], i); set(RAdj[v], j); }
+        else if (w != graph::inf) { Adj[u].emplace_back(u, v, w); RAdj[v].emplace_back(u, v, w); }
+    }
+
+    /**< @brief 辺(u, v, w)を緩和し、v.dが減少すればvをQに入れる */
+    void relax(index_t u, index_t v, weight_t w)
+    {
+        if (S.d[u] + w < S.d[v]) {
+            S.d[v] = S.d[u] + w; S.pi[v] = u; S.paint(v, color::black);
+            Q.push(v, S.d[v]); updated++;
+        }
+    }
+};
+
+
+
+#endif  // end of __DYNAMICSSSP_HPP__
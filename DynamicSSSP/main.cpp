@@ -0,0 +1,108 @@
+/**
+ * @brief  動的単一始点最短路の動作確認
+ * @date   2026/10/15
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include "dynamicsssp.hpp"
+#include "../Graph/csr.hpp"
+#include "../Dijkstra/dijkstra.hpp"
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**
+ * @brief  保守している最短路重みがdijkstraを始めから実行した結果と一致し、先行点が最短路木をなすか否かを返す
+ */
+bool check(const dynamicsssp& D, const vertices_t& V)
+{
+    std::int32_t n = D.size();
+    for (index_t v = 0; v < n; v++) {
+        if (D.S.d[v] != V[v].d || D.S.colorof(v) != V[v].color) { return false; }
+        index_t u = D.S.pi[v];
+        if (v == D.s || D.S.d[v] == graph::inf) { if (u != graph::nil) { return false; } continue; }
+        if (u == graph::nil || D.S.d[u] + D.weight(u, v) != D.S.d[v]) { return false; }
+    }
+    return true;
+}
+
+
+
+int main(void)
+{
+    using namespace std;
+
+    // 教科書の図24.6のグラフ
+    graph_t G(5);
+    G[0].emplace_back(0, 1, 10); G[0].emplace_back(0, 3, 5);
+    G[1].emplace_back(1, 2, 1);  G[1].emplace_back(1, 3, 2);
+    G[2].emplace_back(2, 4, 4);
+    G[3].emplace_back(3, 1, 3);  G[3].emplace_back(3, 2, 9); G[3].emplace_back(3, 4, 2);
+    G[4].emplace_back(4, 0, 7);  G[4].emplace_back(4, 2, 6);
+    dynamicsssp D(G, 0);
+    auto print = [&D]() {
+        for (std::size_t v = 0; v < D.size(); v++) { cout << D.S.d[v] << " "; }
+        cout << endl;
+    };
+    print();                                        // 0 8 9 5 7
+    D.update(3, 1, 1); print();                     // 減少 : 0 6 7 5 7
+    D.update(0, 3, graph::inf); print();            // 削除 : 0 10 11 12 14
+    D.update(edges_t{ edge(0, 2, 3), edge(1, 2, 20) }); print();  // 挿入と増加 : 0 10 3 12 7
+
+    // 無作為な更新のバッチを反映するたびに、dijkstraを始めから実行した結果と比較する
+    const std::int32_t n = 1 << 16, m = 8 * n;
+    mt19937 mt(1);
+    uniform_int_distribution<index_t>  vdist(0, n - 1);
+    uniform_int_distribution<weight_t> wdist(0, 100);  // 重み0の辺も含める
+    edges_t E;
+    for (std::int32_t i = 0; i < m; i++) { E.emplace_back(vdist(mt), vdist(mt), wdist(mt)); }
+    dynamicsssp H(csrgraph(n, E), 0);
+
+    bool ok = true;
+    double trepair = 0, tfresh = 0; std::int64_t updated = 0;
+    for (std::int32_t k : { 1, 10, 100, 1000, 4000 }) {
+        for (std::int32_t r = 0; r < 10; r++) {
+            edges_t B;
+            for (std::int32_t i = 0; i < k; i++) {
+                switch (mt() % 4) {
+                case 0:  B.emplace_back(vdist(mt), vdist(mt), wdist(mt)); break;  // 挿入(または変更)
+                case 1: {                                                        // 最短路木の辺の削除
+                    index_t v = vdist(mt);
+                    if (H.S.pi[v] != graph::nil) { B.emplace_back(H.S.pi[v], v, graph::inf); }
+                    break;
+                }
+                default: {                                                       // 既存の辺の重みの変更
+                    index_t u = vdist(mt);
+                    if (!H.Adj[u].empty()) { B.emplace_back(u, H.Adj[u][mt() % H.Adj[u].size()].dst, wdist(mt)); }
+                    break;
+                }
+                }
+            }
+            auto t0 = chrono::steady_clock::now();
+            H.update(B);
+            auto t1 = chrono::steady_clock::now();
+            vertices_t V = dijkstra(H.Adj, 0);
+            auto t2 = chrono::steady_clock::now();
+            trepair += chrono::duration<double, milli>(t1 - t0).count();
+            tfresh  += chrono::duration<double, milli>(t2 - t1).count();
+            updated += H.updated;
+            ok = ok && check(H, V);
+        }
+        cout << "batch " << k << ": repair " << trepair / 10 << " ms, dijkstra " << tfresh / 10 << " ms, "
+             << "updated " << updated / 10 << " / " << n << endl;
+        trepair = tfresh = 0; updated = 0;
+    }
+    cout << (ok ? "ok" : "NG") << endl;
+    return 0;
+}
@@ -37,7 +37,7 @@
 //****************************************
 
 #include "floydwarshall.hpp"
-#include <iostream>
+#include <algorithm>
 
 
 
@@ -100,37 +100,127 @@ matrix_t floydwarshall(const matrix_t& W)
 }
 
 
+/**
+ * @brief  タイルAとタイルBのmin-plus積でタイルCを更新する. すなわち、k = 0,1,...,nk-1の順に
+ *         すべてのi, jについてcij = min(cij, aik + bkj)とする
+ *
+ * @note   C = AまたはC = Bであってもよい(akk >= 0, bkk >= 0なので、第k行と第k列はk番目の反復で変化しない)
+ *         最内ループには分岐がなく、連続した要素を走査するので、コンパイラによってSIMD命令に変換される
+ *
+ * @param  std::int32_t ld 行列の行の長さ(タイル内で次の行に進むときの間隔)
+ */
+static void minplus(weight_t* c, const weight_t* a, const weight_t* b,
+                    std::int32_t ni, std::int32_t nj, std::int32_t nk, std::int32_t ld)
+{
+    for (std::int32_t k = 0; k < nk; k++) {
+        const weight_t* bk = b + std::size_t(k) * ld;
+        for (std::int32_t i = 0; i < ni; i++) {
+            weight_t* ci  = c + std::size_t(i) * ld;
+            weight_t  aik = a[std::size_t(i) * ld + k];
+            for (std::int32_t j = 0; j < nj; j++) {
+                ci[j] = std::min(ci[j], aik + bk[j]);
+            }
+        }
+    }
+}
 
-int main(void)
+
+/**
+ * @brief  先行点行列を伴うmin-plus積. cijを更新するときにpij = qkjとする
+ *
+ * @note   CとPはどちらも32ビット整数の配列なので、コンパイラは両者が重ならないことを証明できず、最内ループをSIMD命令に変換しない
+ *         各jの更新は互いに独立なので(ci = bkのときも同じ添字jの要素しか参照しない)、omp simdでベクトル化を指示する
+ *         参照を返すstd::minは一時変数を生じてベクトル化を妨げるので、cijは値で選択し、pijは比較結果のビットマスクで選択する
+ */
+static void minplus(weight_t* c, index_t* p, const weight_t* a, const weight_t* b, const index_t* q,
+                    std::int32_t ni, std::int32_t nj, std::int32_t nk, std::int32_t ld)
 {
-    using namespace std;
-    using namespace graph;
-    const std::int32_t n = 5;
-    weight_t M[n][n] = {
-        {   0,   3,   8, inf,  -4, },
-        { inf,   0, inf,   1,   7, },
-        { inf,   4,   0, inf, inf, },
-        {   2, inf,  -5,   0, inf, },
-        { inf, inf, inf,   6,   0, },
-    };
+    for (std::int32_t k = 0; k < nk; k++) {
+        const weight_t* bk = b + std::size_t(k) * ld;
+        const index_t*  qk = q + std::size_t(k) * ld;
+        for (std::int32_t i = 0; i < ni; i++) {
+            weight_t* ci  = c + std::size_t(i) * ld;
+            index_t*  pi  = p + std::size_t(i) * ld;
+            weight_t  aik = a[std::size_t(i) * ld + k];
+#pragma omp simd
+            for (std::int32_t j = 0; j < nj; j++) {
+                weight_t s    = aik + bk[j], cij = ci[j];
+                index_t  mask = -index_t(s < cij);  // s < cijならばすべてのビットが1、そうでなければ0
+                ci[j] = (s < cij) ? s : cij;
+                pi[j] = (qk[j] & mask) | (pi[j] & ~mask);
+            }
+        }
+    }
+}
+
 
-    matrix_t W(n);
-    for (int i = 0; i < n; i++) {
-        W[i].resize(n);
-        for (int j = 0; j < n; j++) {
-            W[i][j] = M[i][j];
+/**
+ * @brief  タイル化(cache-blocked)したマルチスレッド版Floyd-Warshallアルゴリズム
+ */
+void floydwarshall(flatmatrix<weight_t>& D, flatmatrix<index_t>* P, std::int32_t bs)
+{
+    std::int32_t n = D.size(), dim = D.dim, nb = (dim + bs - 1) / bs;
+    for (index_t i = 0; i < n; i++) { D(i, i) = 0; }
+    if (P != nullptr) {  // πij = i (i != jかつwij < ∞のとき), NIL (それ以外のとき)
+        *P = flatmatrix<index_t>(n, graph::nil);
+        for (index_t i = 0; i < n; i++) {
+            for (index_t j = 0; j < n; j++) { (*P)(i, j) = (i != j && D(i, j) < graph::inf) ? i : index_t(graph::nil); }
         }
     }
 
-    matrix_t D = floydwarshall(W);
+    // タイルD[I][J]を、中間頂点をタイルKに属する頂点に限って更新する
+    auto update = [&](std::int32_t I, std::int32_t J, std::int32_t K) {
+        std::int32_t i = I * bs, j = J * bs, k = K * bs;
+        std::int32_t ni = std::min(bs, dim - i), nj = std::min(bs, dim - j), nk = std::min(bs, dim - k);
+        if (P == nullptr) { minplus(D.row(i) + j, D.row(i) + k, D.row(k) + j, ni, nj, nk, dim); }
+        else { minplus(D.row(i) + j, P->row(i) + j, D.row(i) + k, D.row(k) + j, P->row(k) + j, ni, nj, nk, dim); }
+    };
+
+
+    for (std::int32_t K = 0; K < nb; K++) {
+        update(K, K, K);                                   // 1. 対角タイル
+#pragma omp parallel for schedule(dynamic)
+        for (std::int32_t J = 0; J < nb; J++) {            // 2. K行とK列のタイル
+            if (J != K) { update(K, J, K); update(J, K, K); }
+        }
+#pragma omp parallel for collapse(2) schedule(dynamic)
+        for (std::int32_t I = 0; I < nb; I++) {            // 3. 残りのタイル
+            for (std::int32_t J = 0; J < nb; J++) {
+                if (I != K && J != K) { update(I, J, K); }
+            }
+        }
+    }
 
-    for (int i = 0; i < n; i++) {
-        for (int j = 0; j < n; j++) {
-            cout << D[i][j] << " ";
+    // ∞に負辺の重みが加わった値を∞に戻す
+#pragma omp parallel for
+    for (index_t i = 0; i < n; i++) {
+        for (index_t j = 0; j < n; j++) {
+            if (D(i, j) > graph::inf / 2) {
+                D(i, j) = graph::inf;
+                if (P != nullptr) { (*P)(i, j) = graph::nil; }
+            }
         }
-        cout << endl;
     }
-    
-    return 0;
 }
 
+
+/**
+ * @brief  有向グラフの推移的閉包を求める
+ */
+void transitiveclosure(bitmatrix& T)
+{
+    using word_t = bitmatrix::word_t;
+    std::int32_t n = T.size();
+    std::size_t  stride = T.stride;
+    for (index_t i = 0; i < n; i++) { T.set(i, i); }  // tii^(0) = 1
+
+    for (index_t k = 0; k < n; k++) {
+        const word_t* rk = T.row(k);
+#pragma omp parallel for schedule(static)
+        for (index_t i = 0; i < n; i++) {
+            if (i == k || !T.test(i, k)) { continue; }  // tik = 0ならば行iは変化しない
+            word_t* ri = T.row(i);
+            for (std::size_t w = 0; w < stride; w++) { ri[w] |= rk[w]; }
+        }
+    }
+}
@@ -46,6 +46,8 @@
 //****************************************
 
 #include "../Graph/graph.hpp"
+#include "../Graph/flatmatrix.hpp"
+#include "../Graph/bitmatrix.hpp"
 
 
 
@@ -93,5 +95,46 @@
 matrix_t floydwarshall(const matrix_t& W);
 
 
+/**
+ * @brief  タイル化(cache-blocked)したマルチスレッド版Floyd-Warshallアルゴリズム
+ *
+ * @note   行列Dをbs x bsのタイルD[I][J]に分割する. 外側のループをタイルの添字Kについて回し、
+ *         中間頂点をタイルKに属する頂点に限った更新を次の3段階で行う
+ *           1. 対角タイルD[K][K]をそれ自身で更新する
+ *           2. K行のタイルD[K][J]とK列のタイルD[I][K]をD[K][K]を用いて更新する(互いに独立なので並列に実行する)
+ *           3. 残りのタイルD[I][J]をD[I][K]とD[K][J]を用いて更新する(互いに独立なので並列に実行する)
+ *         各段階は3つのタイルだけを参照するので、タイルがキャッシュに収まれば主記憶へのアクセスはΘ(n^3 / bs)回で済む
+ *
+ * @note   最内ループはmin-plus積の1行分であり、∞の判定を行わない(分岐がないのでSIMD命令に変換される)
+ *         ∞ = graph::infは型の最大値の1/3なので、∞ + ∞も溢れない. 負辺を含む場合、∞から少し小さい値が生じうるが、
+ *         最後にinf / 2を超える値を∞に戻す. したがって、最短路重みの絶対値はinf / 2未満であると仮定する
+ *
+ * @note   Pがnullptrでなければ、先行点行列Πも計算してPに格納する. 要素の更新と同時に、
+ *         dij > dik + dkjならばπij = πkjとする(分岐のない選択として書く)
+ *
+ * @param  flatmatrix<weight_t>& D  辺重み行列W(手続き終了時には最短路重み行列)
+ * @param  flatmatrix<index_t>*  P  先行点行列Πの格納先(不要ならばnullptr)
+ * @param  std::int32_t          bs タイルの大きさ(flatmatrix<weight_t>::alignの倍数)
+ */
+void floydwarshall(flatmatrix<weight_t>& D, flatmatrix<index_t>* P = nullptr, std::int32_t bs = 64);
+
+
+/**
+ * @brief  有向グラフの推移的閉包(transitive closure)を求める
+ *
+ * @note   G* = (V, E*)をGの推移的閉包とする. ただし、E* = { (i, j) : Gにはiからjへの道が存在する }である
+ *         Floyd-Warshallアルゴリズムの算術演算min, +を論理演算∨, ∧に置き換えると、
+ *           tij^(k+1) = tij^(k) ∨ (tik^(k) ∧ tkj^(k))
+ *         によって推移的閉包が求まる(tij^(0)はi = jまたは(i, j) ∈ Eのとき1、そうでなければ0である)
+ *
+ * @note   tik^(k) = 1である各行iについて、T[i] <- T[i] ∨ T[k]を行単位で計算すれば、64要素を1語の論理和でまとめて更新できる
+ *         k行目はk回目の反復で変化しない(T[k] ∨ T[k] = T[k])ので、各行の更新は互いに独立であり、並列に実行できる
+ *         実行時間はΘ(V^3 / 64)、記憶量はΘ(V^2 / 64)語である
+ *
+ * @param  bitmatrix& T 隣接行列(手続き終了時には推移的閉包. 対角要素は1になる)
+ */
+void transitiveclosure(bitmatrix& T);
+
+
 
 #endif  // end of __FLOYDWARSHALL_HPP__
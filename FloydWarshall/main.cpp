@@ -0,0 +1,114 @@
+/**
+ * @brief  Floyd-Warshallアルゴリズムのテストを行う
+ * @date   作成日     : 2016/02/21
+ * @date   最終更新日 : 2026/10/15
+ */
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include "floydwarshall.hpp"
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+int main(void)
+{
+    using namespace std;
+    using namespace graph;
+    const std::int32_t n = 5;
+    weight_t M[n][n] = {
+        {   0,   3,   8, inf,  -4, },
+        { inf,   0, inf,   1,   7, },
+        { inf,   4,   0, inf, inf, },
+        {   2, inf,  -5,   0, inf, },
+        { inf, inf, inf,   6,   0, },
+    };
+
+    matrix_t W(n);
+    for (int i = 0; i < n; i++) {
+        W[i].resize(n);
+        for (int j = 0; j < n; j++) {
+            W[i][j] = M[i][j];
+        }
+    }
+
+    matrix_t D = floydwarshall(W);
+
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            cout << D[i][j] << " ";
+        }
+        cout << endl;
+    }
+
+    // タイル化した版は先行点行列も求める
+    flatmatrix<weight_t> F(W, graph::inf);
+    flatmatrix<index_t>  P;
+    floydwarshall(F, &P);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            cout << F(i, j) << "/" << P(i, j) << " ";
+        }
+        cout << endl;
+    }
+
+    // 負辺を含む(が負閉路は含まない)ランダムグラフ上で両者を比較し、先行点行列から復元した路の重みを確かめる
+    // 頂点のポテンシャルhを用いてw(u, v) = w'(u, v) + h(v) - h(u) (w' >= 0)とすれば、どの閉路の重みも非負である
+    const int m = 700;
+    mt19937 mt(1);
+    uniform_int_distribution<weight_t> hdist(0, 100), wdist(0, 1000);
+    uniform_real_distribution<double>   coin(0.0, 1.0);
+    array_t  h(m); for (auto& x : h) { x = hdist(mt); }
+    matrix_t R(m, array_t(m, graph::inf));
+    for (int i = 0; i < m; i++) {
+        for (int j = 0; j < m; j++) {
+            if (i != j && coin(mt) < 0.01) { R[i][j] = wdist(mt) + h[j] - h[i]; }
+        }
+    }
+    auto start    = chrono::steady_clock::now();
+    auto expected = floydwarshall(R);
+    auto middle   = chrono::steady_clock::now();
+    flatmatrix<weight_t> T(R, graph::inf);
+    floydwarshall(T);
+    auto stop     = chrono::steady_clock::now();
+    flatmatrix<weight_t> U(R, graph::inf);
+    floydwarshall(U, &P);
+    auto last     = chrono::steady_clock::now();
+
+    bool ok = true;
+    for (int i = 0; i < m; i++) {
+        for (int j = 0; j < m; j++) {
+            ok = ok && expected[i][j] == T(i, j) && expected[i][j] == U(i, j);
+            if (i == j || T(i, j) == graph::inf) { continue; }
+            weight_t w = 0;
+            for (index_t v = j; v != i; v = P(i, v)) { w += R[P(i, v)][v]; }
+            ok = ok && w == T(i, j);
+        }
+    }
+    cout << "textbook : " << chrono::duration<double, milli>(middle - start).count() << " ms" << endl;
+    cout << "tiled    : " << chrono::duration<double, milli>(stop - middle).count()  << " ms" << endl;
+    cout << "tiled(Π) : " << chrono::duration<double, milli>(last - stop).count()    << " ms" << endl;
+
+    // ビット行列上の推移的閉包は、最短路重みが有限である頂点対の集合に一致する
+    bitmatrix C(R);
+    auto before = chrono::steady_clock::now();
+    transitiveclosure(C);
+    auto after  = chrono::steady_clock::now();
+    for (int i = 0; i < m; i++) {
+        for (int j = 0; j < m; j++) { ok = ok && C.test(i, j) == (T(i, j) != graph::inf); }
+    }
+    cout << "closure  : " << chrono::duration<double, milli>(after - before).count() << " ms" << endl;
+    cout << (ok ? "ok" : "ng") << endl;
+    
+    return 0;
+}
+
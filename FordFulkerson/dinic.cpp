@@ -0,0 +1,137 @@
+/**
+ * @brief  Dinicのアルゴリズムの動作確認
+ *
+ * @note   次のことを確かめる
+ *           1. 逆平行辺も多重辺もない小さなランダムグラフで、fordfulkersonと同じ最大フローが得られる
+ *           2. 逆平行辺と多重辺を含む小さなランダムグラフで、最大フローが全数探索による最小カットの容量に等しい
+ *           3. 各辺のフローが容量制限とフロー保存則を満たし、mincutが返すカットの容量が最大フローに等しい
+ *           4. graph::infより大きな容量の辺だけからなる道でも、正しい値が得られる
+ *           5. 長さ10^6の道でも、呼び出しスタックを溢れさせずに求まる
+ *
+ * @date   2026/10/16
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include "dinic.hpp"
+#include "fordfulkerson.hpp"
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**
+ * @brief  Dinicのアルゴリズムで求めたフローが値flowの正しいフローであり、mincutの容量がflowに等しいか否かを返す
+ */
+bool check(const dinic& D, index_t s, index_t t, capacity_t flow)
+{
+    std::vector<std::int64_t> excess(D.n, 0);
+    for (std::size_t i = 0; i < D.E.size(); i++) {
+        capacity_t f = D.flow(i);
+        if (f < 0 || f > D.E[i].c) { return false; }
+        excess[D.E[i].src] -= f; excess[D.E[i].dst] += f;
+    }
+    for (index_t v = 0; v < D.n; v++) {
+        if (v != s && v != t && excess[v] != 0) { return false; }
+    }
+    if (s != t && (excess[t] != flow || excess[s] != -flow)) { return false; }
+
+    std::vector<std::uint8_t> inS(D.n, 0);
+    for (auto v : D.mincut()) { inS[v] = 1; }
+    if (!inS[s] || (s != t && inS[t])) { return false; }
+    std::int64_t cut = 0;
+    for (const auto& e : D.E) { if (inS[e.src] && !inS[e.dst]) { cut += e.c; } }
+    return cut == flow;
+}
+
+
+/**
+ * @brief  すべてのカットを列挙して、最小カットの容量を返す(頂点数が小さいグラフに限る)
+ */
+std::int64_t bruteforcecut(std::int32_t n, const edges_t& E, index_t s, index_t t)
+{
+    std::int64_t best = INT64_MAX;
+    for (std::uint32_t S = 0; S < (1u << n); S++) {
+        if (!(S >> s & 1) || (S >> t & 1)) { continue; }
+        std::int64_t cut = 0;
+        for (const auto& e : E) { if ((S >> e.src & 1) && !(S >> e.dst & 1)) { cut += e.c; } }
+        best = std::min(best, cut);
+    }
+    return best;
+}
+
+
+
+int main(void)
+{
+    using namespace std;
+    mt19937 mt(1);
+    bool ok = true;
+
+    // 1. 逆平行辺も多重辺もないグラフでfordfulkersonと比較する
+    for (int r = 0; r < 200 && ok; r++) {
+        std::int32_t n = 2 + mt() % 30;
+        graph_t G(n);
+        matrix_t used(n, array_t(n, 0));
+        for (int i = 0; i < 4 * n; i++) {
+            index_t u = mt() % n, v = mt() % n;
+            if (u == v || used[u][v] || used[v][u]) { continue; }
+            used[u][v] = 1; G[u].emplace_back(u, v, capacity_t(mt() % 100));
+        }
+        dinic D(G); fordfulkerson F(G);
+        capacity_t f = D.execute(0, n - 1);
+        ok = f == F.execute(0, n - 1) && check(D, 0, n - 1, f);
+    }
+    cout << "fordfulkerson  : " << (ok ? "ok" : "ng") << endl;
+
+    // 2. 逆平行辺と多重辺を含むグラフで、全数探索による最小カットと比較する
+    for (int r = 0; r < 500 && ok; r++) {
+        std::int32_t n = 2 + mt() % 9;
+        dinic D(n);
+        for (int i = 0; i < 3 * n; i++) {
+            index_t u = mt() % n, v = mt() % n;
+            if (u == v) { continue; }
+            D.addedge(u, v, mt() % 20);
+            if (mt() % 4 == 0) { D.addedge(v, u, mt() % 20); }  // 逆平行辺
+            if (mt() % 4 == 0) { D.addedge(u, v, mt() % 20); }  // 多重辺
+        }
+        index_t s = mt() % n, t = mt() % n;
+        if (s == t) { ok = D.execute(s, t) == 0 && check(D, s, t, 0); continue; }
+        capacity_t f = D.execute(s, t);
+        ok = f == bruteforcecut(n, D.E, s, t) && check(D, s, t, f);
+    }
+    cout << "brute force    : " << (ok ? "ok" : "ng") << endl;
+
+    // 4. graph::infより大きな容量
+    {
+        dinic D(4);
+        D.addedge(0, 1, 1000000000); D.addedge(1, 3, 1100000000);
+        D.addedge(0, 2, 1100000000); D.addedge(2, 3, 1000000000);
+        capacity_t f = D.execute(0, 3);
+        ok = ok && f == 2000000000 && check(D, 0, 3, f);
+    }
+    cout << "large capacity : " << (ok ? "ok" : "ng") << endl;
+
+    // 5. 長さ10^6の道(容量は途中の1辺だけが小さい)
+    {
+        const std::int32_t n = 1000000;
+        dinic D(n);
+        for (index_t u = 0; u + 1 < n; u++) { D.addedge(u, u + 1, u == n / 2 ? 7 : 100); }
+        auto start = chrono::steady_clock::now();
+        capacity_t f = D.execute(0, n - 1);
+        auto stop = chrono::steady_clock::now();
+        ok = ok && f == 7 && check(D, 0, n - 1, f) && D.mincut().size() == std::size_t(n / 2 + 1);
+        cout << "path           : " << (ok ? "ok" : "ng") << " (" << chrono::duration<double, milli>(stop - start).count()
+             << " ms)" << endl;
+    }
+    return ok ? 0 : 1;
+}
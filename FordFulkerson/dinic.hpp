@@ -0,0 +1,169 @@
+/**
+ * @brief  最大フローを求めるDinicのアルゴリズムを扱う
+ * @date   2026/10/15
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef __DINIC_HPP__
+#define __DINIC_HPP__
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <algorithm>
+#include "../Graph/graph.hpp"
+#include "../Graph/residual.hpp"
+#include "../Queue/queue.hpp"
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief Dinicのアルゴリズム
+ * @note  Ford-Fulkerson法の各反復で、増加可能経路を1本ずつではなく、まとめて求める
+ *          1. 残余ネットワークGfでsから幅優先探索を行い、各頂点の水準(level)(sからの距離)を求める
+ *             水準がちょうど1増える残余辺だけからなる部分グラフをレベルグラフ(level graph)と呼ぶ
+ *          2. レベルグラフ上のsからtへの道にフローを流し、どの道も飽和させる(このようなフローを阻止フロー(blocking flow)と呼ぶ)
+ *        阻止フローを流すたびにsからtへの最短路長は真に増加するので、反復は高々|V| - 1回である
+ *
+ * @note  阻止フローは、レベルグラフ上の深さ優先探索を明示的なスタックで行って求める(長い道でも呼び出しスタックが溢れない)
+ *        各頂点は現在の辺(current arc)を持ち、行き止まりと分かった辺や飽和した辺は二度と調べない
+ *        したがって、1回の阻止フローはΟ(VE)時間で求まり、全体の実行時間は容量の値によらずΟ(V^2E)である
+ *        残余ネットワークは疎な表現(residualgraph)を用いるので、記憶量はΘ(V + E)である
+ */
+struct dinic {
+    std::int32_t  n;      /**< 頂点v ∈ Vの数 */
+    edges_t       E;      /**< 辺(u, v) ∈ Eとその容量 */
+    residualgraph Gf;     /**< 残余ネットワークGf */
+    indices_t     level;  /**< 頂点の水準(sから到達できない頂点はNIL) */
+    offsets_t     cur;    /**< 頂点の現在の辺(current arc) */
+
+    explicit dinic(std::size_t size) : n(size) {}
+    explicit dinic(const graph_t& G) : dinic(G.size())
+    {
+        for (index_t i = 0; i < n; i++) {
+            for (auto& e : G[i]) { addedge(e.src, e.dst, e.c); }
+        }
+    }
+
+    /**
+     * @brief  容量capの辺(u, v)を加える
+     * @note   fordfulkersonと異なり、逆平行辺や多重辺があってもよい
+     */
+    void addedge(index_t u, index_t v, capacity_t cap)
+    {
+        E.emplace_back(u, v, cap);
+    }
+
+    /**
+     * @brief  Dinicのアルゴリズムを実行する
+     * @param  index_t s フローネットワークの入口(source) s
+     * @param  index_t t フローネットワークの出口(sink) t
+     * @return フローネットワークの最大フロー
+     */
+    capacity_t execute(index_t s, index_t t)
+    {
+        Gf = residualgraph(n, E);
+        capacity_t flow = 0;
+        if (s == t) { bfs(s, t); return flow; }  // mincutのために、sから到達できる頂点の水準を求めておく
+        while (bfs(s, t)) { flow += blocking(s, t); }  // tに到達できる限り、阻止フローを流す
+        return flow;
+    }
+
+    /**
+     * @brief  i番目に加えた辺のフローを返す
+     */
+    capacity_t flow(std::size_t i) const
+    {
+        return E[i].c - Gf.arcs[Gf.forward[i]].cf;
+    }
+
+    /**
+     * @brief  最小カット(S, T)の入口側の頂点集合S(残余ネットワークでsから到達できる頂点全体)を返す
+     * @note   executeの後に呼び出すこと
+     */
+    indices_t mincut() const
+    {
+        indices_t S;
+        for (index_t v = 0; v < n; v++) { if (level[v] != graph::nil) { S.push_back(v); } }
+        return S;
+    }
+
+private:
+    /**
+     * @brief  残余ネットワークGfでsから幅優先探索を行い、各頂点の水準を求める
+     * @return tに到達できるか否か
+     */
+    bool bfs(index_t s, index_t t)
+    {
+        level.assign(n, graph::nil);
+        queue<index_t> Q(n);
+        level[s] = 0; Q.enqueue(s);
+        while (!Q.empty()) {
+            index_t u = Q.dequeue();
+            for (offset_t a = Gf.begin(u); a < Gf.end(u); a++) {
+                index_t v = Gf.arcs[a].dst;
+                if (level[v] == graph::nil && Gf.arcs[a].cf > 0) { level[v] = level[u] + 1; Q.enqueue(v); }
+            }
+        }
+        cur.assign(Gf.offsets.begin(), Gf.offsets.end() - 1);
+        return level[t] != graph::nil;
+    }
+
+    /**
+     * @brief  レベルグラフ上の阻止フローを流し、その値を返す
+     * @note   スタックPにはsから現在の頂点uまでの道の残余辺を積む
+     *           前進(advance) : uの現在の辺がレベルグラフの辺ならば、それをPに積んでその終点に進む
+     *           後退(retreat) : uの現在の辺が尽きれば、uは行き止まりなので、Pの最後の辺を取り除き、その始点の現在の辺を1つ進める
+     *           増加(augment) : u = tに達すれば、Pに沿ってPの残余容量だけフローを流し、飽和した最初の辺の手前まで戻る
+     */
+    capacity_t blocking(index_t s, index_t t)
+    {
+        capacity_t flow = 0;
+        std::vector<offset_t> P;
+        auto src = [&](offset_t a) -> index_t { return Gf.arcs[Gf.arcs[a].rev].dst; };
+
+        index_t u = s;
+        while (true) {
+            if (u == t) {  // 増加
+                capacity_t delta = Gf.arcs[P[0]].cf;  // graph::infより大きな容量もありうるので、Pの最初の辺から始める
+                for (auto a : P) { delta = std::min(delta, Gf.arcs[a].cf); }
+                std::size_t k = P.size();
+                for (std::size_t i = P.size(); i-- > 0; ) {
+                    Gf.push(P[i], delta);
+                    if (Gf.arcs[P[i]].cf == 0) { k = i; }
+                }
+                flow += delta;
+                u = src(P[k]); P.resize(k);
+                continue;
+            }
+            offset_t& a = cur[u];
+            while (a < Gf.end(u) && !(Gf.arcs[a].cf > 0 && level[Gf.arcs[a].dst] == level[u] + 1)) { a++; }
+            if (a < Gf.end(u)) {  // 前進
+                P.push_back(a); u = Gf.arcs[a].dst;
+            }
+            else {                // 後退
+                if (u == s) { break; }
+                level[u] = graph::nil;  // uからtへはもう到達できない
+                offset_t b = P.back(); P.pop_back();
+                u = src(b); cur[u]++;
+            }
+        }
+        return flow;
+    }
+};
+
+
+
+#endif  // end of __DINIC_HPP__
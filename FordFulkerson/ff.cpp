@@ -11,6 +11,7 @@
 //****************************************
 
 #include "fordfulkerson.hpp"
+#include "dinic.hpp"
 #include <iostream>
 
 
@@ -39,6 +40,10 @@ int main(void)
 
     cout << max_flow << endl;
 
+    // 同じインターフェースを持つDinicのアルゴリズムでも同じ最大フローが得られる
+    dinic dn(G);
+    if (dn.execute(0, V - 1) != max_flow) { cout << "mismatch" << endl; }
+
     return 0;
 }
 
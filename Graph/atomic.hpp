@@ -0,0 +1,130 @@
+/**
+ * @brief  マルチスレッド化されたグラフアルゴリズムで用いる不可分(atomic)操作の置き場
+ *
+ * @note   頂点属性は通常の配列(indices_tやarray_tなど)に格納したまま、複数のストランドから更新したい
+ *         そこで、std::atomicで配列を包むのではなく、GCC/Clangの__atomic組み込み関数を用いて
+ *         配列の各要素に直接不可分操作を行う
+ *
+ * @date   2026/10/15
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef __ATOMIC_HPP__
+#define __ATOMIC_HPP__
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <cstdint>
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**< @brief *pを不可分に読み出す */
+template <class T>
+inline T atomic_load(const T* p)
+{
+    return __atomic_load_n(p, __ATOMIC_RELAXED);
+}
+
+/**< @brief *pにxを不可分に書き込む */
+template <class T>
+inline void atomic_store(T* p, T x)
+{
+    __atomic_store_n(p, x, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief  比較交換(compare-and-swap)
+ * @note   *p == expectedならば*pをdesiredに置き換えてtrueを返し、そうでなければ何もせずにfalseを返す
+ */
+template <class T>
+inline bool cas(T* p, T expected, T desired)
+{
+    return __atomic_compare_exchange_n(p, &expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED);
+}
+
+/**< @brief *pにxを不可分に加え、加える前の値を返す */
+template <class T>
+inline T fetch_add(T* p, T x)
+{
+    return __atomic_fetch_add(p, x, __ATOMIC_ACQ_REL);
+}
+
+/**
+ * @brief  *p = min(*p, x)を不可分に実行する
+ * @note   緩和(relax)の並列版で用いる. 値が実際に減少したときに限りtrueを返す
+ */
+template <class T>
+inline bool write_min(T* p, T x)
+{
+    T y = atomic_load(p);
+    while (x < y) {
+        if (__atomic_compare_exchange_n(p, &y, x, true, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)) { return true; }
+        // 失敗した場合、yには現在の*pの値が読み込まれているので、再び比較する
+    }
+    return false;
+}
+
+/**
+ * @brief  less(x, *p)が成り立つ限り*p = xを不可分に実行する
+ * @note   値を複数の成分に詰め込んだ語を、そのうち一部の成分だけで比較したい場合に用いる
+ *         (例えば、上位32ビットに距離、下位32ビットに先行点を持つ語を距離だけで比較する)
+ */
+template <class T, class Compare>
+inline bool write_min(T* p, T x, Compare less)
+{
+    T y = atomic_load(p);
+    while (less(x, y)) {
+        if (__atomic_compare_exchange_n(p, &y, x, true, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)) { return true; }
+    }
+    return false;
+}
+
+
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief  最短路推定値dと先行点πを1つの64ビット語に詰め込む
+ *
+ * @note   上位32ビットにd、下位32ビットにπを置き、比較関数shorterを与えたwrite_minで(d, π)を不可分に更新する
+ *         推定値とは別の配列に先行点を書くと、2つの書き込みの間に別のストランドの更新が割り込みうるので、
+ *         並列な緩和で(d, π)の組を矛盾なく保つにはこの形式を用いる. dは符号付きで比較するので、負の重みも扱える
+ */
+struct packeddist {
+    using word_t = std::uint64_t;
+
+    /**< @brief (d, π)を1語に詰め込む */
+    static word_t pack(std::int32_t d, std::int32_t pi) { return (word_t(std::uint32_t(d)) << 32) | std::uint32_t(pi); }
+
+    /**< @brief 推定値dを取り出す */
+    static std::int32_t dist(word_t x) { return std::int32_t(std::uint32_t(x >> 32)); }
+
+    /**< @brief 先行点πを取り出す */
+    static std::int32_t pred(word_t x) { return std::int32_t(std::uint32_t(x)); }
+
+    /**< @brief 推定値だけを比較する(write_minの比較関数) */
+    struct shorter {
+        bool operator () (word_t x, word_t y) const { return dist(x) < dist(y); }
+    };
+};
+
+
+
+#endif  // end of __ATOMIC_HPP__
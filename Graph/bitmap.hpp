@@ -0,0 +1,107 @@
+/**
+ * @brief  頂点集合を1頂点あたり1ビットで表現するビットマップ
+ *
+ * @note   頂点集合S ⊆ Vを|V|ビットの列で表す. 要素の追加と所属判定はΟ(1)時間であり、
+ *         記憶量はbool_tの配列(1頂点あたり32ビット)の1/32である
+ *         64ビット語ごとにまとめて走査できるので、集合が密な場合には添字の配列よりも扱いやすい
+ *
+ * @date   2026/10/15
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef __BITMAP_HPP__
+#define __BITMAP_HPP__
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <vector>
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief ビットマップ
+ */
+struct bitmap {
+    using word_t = std::uint64_t;
+    enum { bits = 64 };  /**< 1語あたりのビット数 */
+
+    std::vector<word_t> words;  /**< ビット列 */
+    std::size_t n;              /**< 集合の大きさ(ビット数) */
+
+    bitmap() : n(0) {}
+    explicit bitmap(std::size_t n) : words((n + bits - 1) / bits, 0), n(n) {}
+
+    /**< @brief 要素iが集合に属するか判定する */
+    bool test(std::size_t i) const
+    {
+        return (words[i / bits] >> (i % bits)) & 1;
+    }
+
+    /**< @brief 要素iを集合に加える */
+    void set(std::size_t i)
+    {
+        words[i / bits] |= word_t(1) << (i % bits);
+    }
+
+    /**< @brief 要素iを集合から取り除く */
+    void unset(std::size_t i)
+    {
+        words[i / bits] &= ~(word_t(1) << (i % bits));
+    }
+
+    /**
+     * @brief  要素iを不可分に集合に加える
+     * @note   同じ語を複数のストランドが同時に更新してもよい
+     * @return 要素iが新たに加えられたならばtrue
+     */
+    bool atomic_set(std::size_t i)
+    {
+        word_t mask = word_t(1) << (i % bits);
+        return !(__atomic_fetch_or(&words[i / bits], mask, __ATOMIC_RELAXED) & mask);
+    }
+
+    /**< @brief 集合を空にする */
+    void clear()
+    {
+        std::fill(words.begin(), words.end(), 0);
+    }
+
+    /**< @brief 集合の要素数を返す */
+    std::size_t count() const
+    {
+        std::size_t k = 0;
+        for (auto w : words) { k += __builtin_popcountll(w); }
+        return k;
+    }
+
+    /**< @brief 集合の大きさ(ビット数)を返す */
+    std::size_t size() const
+    {
+        return n;
+    }
+
+    void swap(bitmap& b)
+    {
+        words.swap(b.words); std::swap(n, b.n);
+    }
+};
+
+
+
+#endif  // end of __BITMAP_HPP__
@@ -0,0 +1,140 @@
+/**
+ * @brief  重みなしグラフの隣接行列を1要素あたり1ビットで表現するビット行列
+ *
+ * @note   graph.hppの注記のとおり、重み付きではないグラフの隣接行列は1行列要素当たり1ビットで表現できる
+ *         matrix_tは1要素にweight_t(32ビット)を用いるので、ビット行列の記憶量はその1/32であり、|V| = 2^15でも128MiBで済む
+ *         さらに、行を64ビット語の列として扱えば、集合演算(和・積・差)と要素数の計算を64要素ずつまとめて行える
+ *
+ * @note   ビット行列を用いる演算は次のとおりである
+ *           bfs(A, s)             : 語単位でフロンティアを展開する幅優先探索(BFS/bfs.hpp)
+ *           dijkstra(A, s)        : 重みなしグラフの最短路(幅優先探索に帰着する. Dijkstra/dijkstra.cpp)
+ *           transitiveclosure(T)  : 語単位のWarshallのアルゴリズムによる推移的閉包(FloydWarshall/floydwarshall.hpp)
+ *           triangles(A)          : 行の論理積とpopcountによる三角形の数え上げ(Triangles/triangles.hpp)
+ *
+ * @date   2026/10/15
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef __BITMATRIX_HPP__
+#define __BITMATRIX_HPP__
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <cstddef>
+#include <cstdint>
+#include <algorithm>
+#include <vector>
+#include "graph.hpp"
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief  n x nのビット行列
+ * @note   各行は64ビット語stride個からなり、行uの語はwords[u * stride..(u + 1) * stride - 1]である
+ *         行の末尾の余ったビット(列n以降)は常に0に保つので、行単位のpopcountに補正は要らない
+ */
+struct bitmatrix {
+    using word_t = std::uint64_t;
+    enum { bits = 64 };  /**< 1語あたりのビット数 */
+
+    std::vector<word_t> words;   /**< ビット列(行優先) */
+    std::int32_t        n;       /**< 行数(= 列数 = 頂点数|V|) */
+    std::size_t         stride;  /**< 1行あたりの語数 */
+
+    bitmatrix() : n(0), stride(0) {}
+    explicit bitmatrix(std::int32_t n) : words(std::size_t(n) * words_per_row(n), 0), n(n), stride(words_per_row(n)) {}
+
+    /**
+     * @brief  隣接行列W(辺がなければ∞)からビット行列を構築する
+     * @note   対角要素(自己ループ)は含めない
+     */
+    explicit bitmatrix(const matrix_t& W) : bitmatrix(std::int32_t(W.size()))
+    {
+        for (index_t u = 0; u < n; u++) {
+            for (index_t v = 0; v < n; v++) { if (u != v && W[u][v] != graph::inf) { set(u, v); } }
+        }
+    }
+
+    /**
+     * @brief  隣接リスト表現(graph_tまたはcsrgraph)からビット行列を構築する
+     * @note   辺の重みは捨てる. 自己ループは含めない
+     */
+    template <class Graph>
+    static bitmatrix from(const Graph& G)
+    {
+        bitmatrix A(std::int32_t(G.size()));
+        for (index_t u = 0; u < A.n; u++) {
+            for (const auto& e : G[u]) { if (u != e.dst) { A.set(u, e.dst); } }
+        }
+        return A;
+    }
+
+    /**< @brief 行数を返す */
+    std::size_t size() const { return n; }
+
+    /**< @brief 行uの先頭の語へのポインタを返す */
+    word_t*       row(index_t u)       { return words.data() + u * stride; }
+    const word_t* row(index_t u) const { return words.data() + u * stride; }
+
+    /**< @brief 辺(u, v)が存在するか判定する */
+    bool test(index_t u, index_t v) const
+    {
+        return (row(u)[v / bits] >> (v % bits)) & 1;
+    }
+
+    /**< @brief 辺(u, v)を加える */
+    void set(index_t u, index_t v)
+    {
+        row(u)[v / bits] |= word_t(1) << (v % bits);
+    }
+
+    /**< @brief 辺(u, v)を取り除く */
+    void unset(index_t u, index_t v)
+    {
+        row(u)[v / bits] &= ~(word_t(1) << (v % bits));
+    }
+
+    /**< @brief 辺の数(1であるビットの数)を返す */
+    std::size_t count() const
+    {
+        std::size_t k = 0;
+        for (auto w : words) { k += __builtin_popcountll(w); }
+        return k;
+    }
+
+    /**
+     * @brief  転置行列を返す
+     * @note   64 x 64のブロックごとに転置すれば速いが、ここでは単純にビットを1つずつ移す. 実行時間はΘ(V^2 / 64 + E)である
+     */
+    bitmatrix transpose() const
+    {
+        bitmatrix T(n);
+        for (index_t u = 0; u < n; u++) {
+            const word_t* r = row(u);
+            for (std::size_t w = 0; w < stride; w++) {
+                for (word_t x = r[w]; x != 0; x &= x - 1) { T.set(index_t(w * bits + __builtin_ctzll(x)), u); }
+            }
+        }
+        return T;
+    }
+
+    /**< @brief n列を表すのに必要な語数を返す */
+    static std::size_t words_per_row(std::int32_t n) { return (std::size_t(n) + bits - 1) / bits; }
+};
+
+
+
+#endif  // end of __BITMATRIX_HPP__
@@ -0,0 +1,167 @@
+/**
+ * @brief 圧縮疎行列(CSR: compressed sparse row)形式によるグラフ表現
+ *
+ * @note  隣接リスト表現graph_tは各頂点の隣接リストAdj[u]をそれぞれ独立したvectorとして持つため、
+ *        |V|回のヒープ確保が必要であり、隣接リストはメモリ上に散在する
+ *        また、辺edgeは始点srcを冗長に保持している(Adj[u]に属する辺の始点は常にuである)
+ *
+ *        CSR表現では、隣接リストを頂点の添字順に1本の配列へ連結して格納する
+ *          offsets[0..|V|] : Adj[u]はtargets[offsets[u]..offsets[u+1]-1]に格納される
+ *          targets[0..m-1] : 各辺(u, v)の終点v
+ *          weights[0..m-1] : 各辺(u, v)の重みw(u, v)
+ *        記憶量はΘ(V + E)で隣接リスト表現と変わらないが、配列は3本だけであり、
+ *        ある頂点の隣接頂点の走査は連続したメモリの走査になる
+ *
+ * @note  CSRグラフは構築後に変更しない(immutable)ことを前提とする
+ *        G.size()とG[u]によってgraph_tと同じように扱えるので、
+ *        テンプレート化されたグラフアルゴリズムはどちらの表現も受け取ることができる
+ *
+ * @date  2026/10/15
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef __CSR_HPP__
+#define __CSR_HPP__
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+#include "graph.hpp"
+
+
+
+//****************************************
+// 型シノニム
+//****************************************
+
+using offset_t  = std::int64_t;           /**< 辺配列の添字を表す型(|E| >= 2^31でも扱えるように64bitとする) */
+using offsets_t = std::vector<offset_t>;  /**< 隣接リストの開始位置の配列 */
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief  CSRグラフにおける頂点uの隣接リストAdj[u]
+ * @note   要素は辺edge(u, v, w)として値で返されるので、graph_tの隣接リストと同じように走査できる
+ *         (ただし、参照ではないため、for (const auto& e : G[u])のように受け取ること)
+ * @note   重み配列はws要素おきに読む. 重みを持たないグラフ(csrfile.hpp)ではws = 0とし、すべての辺が同じ重みを指す
+ */
+struct csradj {
+    index_t         u;   /**< 辺の始点u */
+    const index_t*  v;   /**< Adj[u]の終点配列の先頭 */
+    const weight_t* w;   /**< Adj[u]の重み配列の先頭 */
+    std::size_t     m;   /**< Adj[u]の長さ */
+    std::ptrdiff_t  ws;  /**< 重み配列の刻み幅(通常は1) */
+
+    /**< @brief Adj[u]を走査する前方反復子 */
+    struct iterator {
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = edge;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = const edge*;
+        using reference         = edge;
+
+        index_t         u;
+        const index_t*  v;
+        const weight_t* w;
+        std::ptrdiff_t  ws;
+
+        edge operator*() const { return edge(u, *v, *w); }
+        iterator& operator++() { ++v; w += ws; return *this; }
+        iterator  operator++(int) { iterator it = *this; ++(*this); return it; }
+        bool operator==(const iterator& it) const { return v == it.v; }
+        bool operator!=(const iterator& it) const { return v != it.v; }
+    };
+
+    iterator begin() const { return iterator{ u, v, w, ws }; }
+    iterator end()   const { return iterator{ u, v + m, w + ws * std::ptrdiff_t(m), ws }; }
+
+    /**< @brief 頂点uの出次数を返す */
+    std::size_t size() const { return m; }
+
+    /**< @brief Adj[u]のi番目の辺を返す */
+    edge operator[](std::size_t i) const { return edge(u, v[i], w[ws * std::ptrdiff_t(i)]); }
+};
+
+
+/**
+ * @brief  CSR形式のグラフG = (V, E)
+ * @note   offsets, targets, weightsの3本の配列だけで|V|個の隣接リストを表現する
+ */
+struct csrgraph {
+    offsets_t offsets;  /**< Adj[u]はtargets[offsets[u]..offsets[u+1]-1]である */
+    indices_t targets;  /**< 辺(u, v)の終点v */
+    array_t   weights;  /**< 辺(u, v)の重みw(u, v) */
+
+    csrgraph() : offsets(1, 0) {}
+
+    /**
+     * @brief  隣接リスト表現graph_tからCSRグラフを構築する
+     * @note   各隣接リスト内の辺の順序は保存される. 実行時間はΘ(V + E)である
+     * @param  const graph_t& G 隣接リスト表現のグラフG
+     */
+    explicit csrgraph(const graph_t& G) : offsets(G.size() + 1, 0)
+    {
+        std::int32_t n = G.size();
+        for (index_t u = 0; u < n; u++) {
+            offsets[u + 1] = offsets[u] + G[u].size();
+        }
+        targets.resize(offsets[n]); weights.resize(offsets[n]);
+        for (index_t u = 0; u < n; u++) {
+            offset_t i = offsets[u];
+            for (auto& e : G[u]) { targets[i] = e.dst; weights[i] = e.w; i++; }
+        }
+    }
+
+    /**
+     * @brief  辺集合E(順不同の辺リスト)からCSRグラフを構築する
+     * @note   始点の出次数を数え上げ、その累積和から各辺の格納位置を決める計数ソートである
+     *         同じ始点を持つ辺の順序は保存される. 実行時間はΘ(V + E)である
+     * @param  std::int32_t   n 頂点数|V|
+     * @param  const edges_t& E 辺集合E
+     */
+    csrgraph(std::int32_t n, const edges_t& E) : offsets(n + 1, 0), targets(E.size()), weights(E.size())
+    {
+        for (auto& e : E) { offsets[e.src + 1]++; }                          // 各頂点の出次数を数え、
+        for (index_t u = 0; u < n; u++) { offsets[u + 1] += offsets[u]; }    // 累積和を取る
+        offsets_t pos(offsets.begin(), offsets.end() - 1);
+        for (auto& e : E) {
+            offset_t i = pos[e.src]++;                                       // 辺(u, v)をAdj[u]の末尾に置く
+            targets[i] = e.dst; weights[i] = e.w;
+        }
+    }
+
+    /**< @brief 頂点数|V|を返す */
+    std::size_t size() const { return offsets.size() - 1; }
+
+    /**< @brief 辺数|E|を返す */
+    std::size_t edges() const { return targets.size(); }
+
+    /**< @brief 頂点uの出次数を返す */
+    std::size_t degree(index_t u) const { return offsets[u + 1] - offsets[u]; }
+
+    /**< @brief 頂点uの隣接リストAdj[u]を返す */
+    csradj operator[](index_t u) const
+    {
+        return csradj{ u, targets.data() + offsets[u], weights.data() + offsets[u], degree(u), 1 };
+    }
+};
+
+
+
+#endif  // end of __CSR_HPP__
@@ -0,0 +1,389 @@
+/**
+ * @brief  CSR形式のグラフのバイナリファイル形式と、メモリマップによる読み込み
+ *
+ * @note   テキストの辺リストを1行ずつ読んでgraph_tを構築すると、数十億辺のグラフでは読み込みだけで数分かかり、
+ *         さらにgraph_tとcsrgraphの2つの複製がメモリ上に必要になる
+ *         ここでは、CSR形式の3本の配列をそのままファイルに書き出す形式を定める. ファイルをmmapで写像すれば、
+ *         配列をコピーせずに読み取り専用のグラフとして扱え、実際に触れたページだけが必要に応じて読み込まれる
+ *
+ * @note   ファイルの構成(すべて書き込んだ計算機のバイト順序による)
+ *           csrheader                   : 32バイトの見出し
+ *           offset_t offsets[n + 1]     : Adj[u]はtargets[offsets[u]..offsets[u+1]-1]である
+ *           index_t  targets[m]         : 各辺(u, v)の終点v
+ *           weight_t weights[m]         : 各辺(u, v)の重みw(u, v)(見出しのflagsにcsrweightedが立っている場合のみ)
+ *         見出しは32バイト、offsetsは8バイトの倍数なので、各配列は要素の大きさに整列している
+ *
+ * @date   2026/10/15
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef __CSRFILE_HPP__
+#define __CSRFILE_HPP__
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "graph.hpp"
+#include "csr.hpp"
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief  CSRファイルの見出し
+ */
+struct csrheader {
+    char          magic[4];  /**< "CSRG" */
+    std::uint32_t version;   /**< 形式の版(現在はcsrversion) */
+    std::uint32_t flags;     /**< csrweightedなどの論理和 */
+    std::uint32_t reserved;  /**< 0 */
+    std::int64_t  n;         /**< 頂点数|V| */
+    std::int64_t  m;         /**< 辺数|E| */
+};
+static_assert(sizeof(csrheader) == 32, "csrheader must be 32 bytes");
+
+const std::uint32_t csrversion  = 1;       /**< 現在の形式の版 */
+const std::uint32_t csrweighted = 1u << 0; /**< 重み配列を持つ */
+
+
+/**
+ * @brief  n頂点m辺のCSRファイルにおける各配列の位置とファイルの大きさ
+ */
+struct csrlayout {
+    std::size_t offsets, targets, weights, size;
+
+    csrlayout(std::int64_t n, std::int64_t m, bool weighted)
+        : offsets(sizeof(csrheader)),
+          targets(offsets + sizeof(offset_t) * (n + 1)),
+          weights(targets + sizeof(index_t) * m),
+          size(weights + (weighted ? sizeof(weight_t) * m : 0)) {}
+};
+
+
+/**
+ * @brief  mmapで写像したCSRファイルを読み取り専用のグラフとして扱う
+ *
+ * @note   G.size()とG[u]によってcsrgraphと同じように扱えるので、テンプレート化されたグラフアルゴリズムにそのまま渡せる
+ *         配列はファイルの写像を直接指すので、openはファイルの大きさによらずΟ(1)時間で終わる
+ *         重みを持たないファイルでは、すべての辺の重みをedge(u, v)と同じく1とする
+ *
+ * @note   写像を所有するので、コピーはできない(ムーブはできる). 破棄されると写像は解除される
+ */
+struct mappedcsr {
+    const offset_t* offsets;  /**< Adj[u]はtargets[offsets[u]..offsets[u+1]-1]である */
+    const index_t*  targets;  /**< 辺(u, v)の終点v */
+    const weight_t* weights;  /**< 辺(u, v)の重みw(u, v)(重みを持たないファイルでは、値1を持つ1要素を指す) */
+    std::ptrdiff_t  ws;       /**< 重み配列の刻み幅(重みを持たないファイルでは0) */
+    std::int64_t    n, m;     /**< 頂点数と辺数 */
+    void*           base;     /**< 写像の先頭 */
+    std::size_t     length;   /**< 写像の長さ */
+
+    mappedcsr() : offsets(zero()), targets(nullptr), weights(one()), ws(0), n(0), m(0), base(nullptr), length(0) {}
+    mappedcsr(const mappedcsr&) = delete;
+    mappedcsr& operator=(const mappedcsr&) = delete;
+    mappedcsr(mappedcsr&& G) noexcept : mappedcsr() { swap(G); }
+    mappedcsr& operator=(mappedcsr&& G) noexcept { swap(G); return *this; }
+    ~mappedcsr() { close(); }
+
+    /**
+     * @brief  CSRファイルを読み取り専用で写像する
+     * @note   見出しの識別子と版、頂点数と辺数の範囲、ファイルの大きさ、offsetsの両端を検査し、不正であればfalseを返す
+     *         頂点数と辺数は配列の位置を計算する前に、index_tで表せることと、ファイルに収まることを確かめる
+     *         offsetsの単調性や終点の範囲など、配列全体を読む検査はΟ(1)時間で終わらないので行わない
+     *         信頼できないファイルは、使う前にverifyで検査すること
+     * @param  const std::string& path ファイル名
+     * @return 写像できたか否か
+     */
+    bool open(const std::string& path)
+    {
+        close();
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) { return false; }
+        struct stat st;
+        if (::fstat(fd, &st) != 0 || std::size_t(st.st_size) < sizeof(csrheader)) { ::close(fd); return false; }
+        void* p = ::mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);  // 写像はファイル記述子を閉じても有効である
+        if (p == MAP_FAILED) { return false; }
+        base = p; length = st.st_size;
+
+        const csrheader& h = *static_cast<const csrheader*>(base);
+        if (std::memcmp(h.magic, "CSRG", 4) != 0 || h.version != csrversion || h.n < 0 || h.m < 0) { close(); return false; }
+        std::uint64_t body = length - sizeof(csrheader);  // 見出しを除いた大きさ. これを超える配列はありえない
+        if (h.n > std::numeric_limits<index_t>::max() || std::uint64_t(h.n) + 1 > body / sizeof(offset_t) ||
+            std::uint64_t(h.m) > body / sizeof(index_t)) { close(); return false; }
+        bool weighted = (h.flags & csrweighted) != 0;
+        csrlayout L(h.n, h.m, weighted);
+        if (L.size != length) { close(); return false; }
+
+        const char* c = static_cast<const char*>(base);
+        offsets = reinterpret_cast<const offset_t*>(c + L.offsets);
+        targets = reinterpret_cast<const index_t*>(c + L.targets);
+        weights = weighted ? reinterpret_cast<const weight_t*>(c + L.weights) : one();
+        ws      = weighted ? 1 : 0;
+        n = h.n; m = h.m;
+        if (offsets[0] != 0 || offsets[n] != m) { close(); return false; }
+        return true;
+    }
+
+    /**
+     * @brief  配列全体を読み、offsetsが0からmまで単調に増加し、すべての終点が頂点であることを確かめる
+     * @note   Ο(V + E)時間かかり、ファイル全体を読み込む. openが検査しないファイルの中身の整合性を保証する
+     * @return 正しいCSR形式のグラフであるか否か
+     */
+    bool verify() const
+    {
+        if (offsets[0] != 0 || offsets[n] != m) { return false; }
+        for (std::int64_t u = 0; u < n; u++) { if (offsets[u] > offsets[u + 1]) { return false; } }
+        for (std::int64_t i = 0; i < m; i++) { if (targets[i] < 0 || targets[i] >= n) { return false; } }
+        return true;
+    }
+
+    /**< @brief 写像を解除する */
+    void close()
+    {
+        if (base) { ::munmap(base, length); }
+        offsets = zero(); targets = nullptr; weights = one(); ws = 0;
+        n = m = 0; base = nullptr; length = 0;
+    }
+
+    /**< @brief 重み配列を持つか否かを返す */
+    bool weighted() const { return ws != 0; }
+
+    /**< @brief 頂点数|V|を返す */
+    std::size_t size() const { return n; }
+
+    /**< @brief 辺数|E|を返す */
+    std::size_t edges() const { return m; }
+
+    /**< @brief 頂点uの出次数を返す */
+    std::size_t degree(index_t u) const { return offsets[u + 1] - offsets[u]; }
+
+    /**< @brief 頂点uの隣接リストAdj[u]を返す */
+    csradj operator[](index_t u) const
+    {
+        return csradj{ u, targets + offsets[u], weights + ws * offsets[u], degree(u), ws };
+    }
+
+    void swap(mappedcsr& G) noexcept
+    {
+        std::swap(offsets, G.offsets); std::swap(targets, G.targets); std::swap(weights, G.weights); std::swap(ws, G.ws);
+        std::swap(n, G.n); std::swap(m, G.m); std::swap(base, G.base); std::swap(length, G.length);
+    }
+
+private:
+    /**< @brief 空のグラフのoffsets */
+    static const offset_t* zero() { static const offset_t z = 0; return &z; }
+    /**< @brief 重みを持たないグラフの辺の重み */
+    static const weight_t* one()  { static const weight_t w = 1; return &w; }
+};
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**
+ * @brief  CSRグラフGをCSRファイルに書き出す
+ * @param  const std::string& path     ファイル名
+ * @param  const csrgraph&    G        グラフG
+ * @param  bool               weighted 重み配列を書き出すか否か
+ * @return 書き出せたか否か
+ */
+inline bool savecsr(const std::string& path, const csrgraph& G, bool weighted = true)
+{
+    std::FILE* fp = std::fopen(path.c_str(), "wb");
+    if (!fp) { return false; }
+    csrheader h = { { 'C', 'S', 'R', 'G' }, csrversion, weighted ? csrweighted : 0, 0,
+                    std::int64_t(G.size()), std::int64_t(G.edges()) };
+    bool ok = std::fwrite(&h, sizeof(h), 1, fp) == 1
+           && std::fwrite(G.offsets.data(), sizeof(offset_t), G.offsets.size(), fp) == G.offsets.size()
+           && std::fwrite(G.targets.data(), sizeof(index_t), G.edges(), fp) == G.edges()
+           && (!weighted || std::fwrite(G.weights.data(), sizeof(weight_t), G.edges(), fp) == G.edges());
+    return std::fclose(fp) == 0 && ok;
+}
+
+
+/**
+ * @brief  テキストの辺リストを、一定の大きさの緩衝領域を介して1行ずつ読む
+ *
+ * @note   各行は"u v"または"u v w"(空白またはタブ区切り)である. '#'または'%'で始まる行と空行は読み飛ばす
+ *         重みのない行の重みは1とする. 頂点番号がindex_tで、重みがweight_tで表せない行は解釈できない行とする
+ */
+struct edgelistreader {
+    std::FILE*        fp;
+    std::vector<char> buf;
+    std::size_t       pos, len;
+    bool              eof;
+    bool              error;  /**< 解釈できない行があったか否か */
+
+    explicit edgelistreader(std::FILE* fp) : fp(fp), buf(1 << 20), pos(0), len(0), eof(false), error(false) {}
+
+    /**
+     * @brief  次の辺を読む
+     * @param  edge& e       読んだ辺
+     * @param  bool& hasw    行が重みを持っていたか否か
+     * @return 辺を読めたか否か(入力の終わりまたは解釈できない行ではfalse)
+     */
+    bool next(edge& e, bool& hasw)
+    {
+        while (true) {
+            fill();
+            while (pos < len && isspace(buf[pos])) { pos++; }
+            if (pos == len) { return false; }
+            if (buf[pos] == '#' || buf[pos] == '%') { skipline(); continue; }
+
+            std::int64_t u, v, w = 1;
+            if (!number(u) || !number(v) || u < 0 || v < 0 || u > INT32_MAX || v > INT32_MAX) { error = true; return false; }
+            while (pos < len && (buf[pos] == ' ' || buf[pos] == '\t')) { pos++; }
+            hasw = pos < len && (buf[pos] == '-' || isdigit(buf[pos]));
+            if (hasw && (!number(w) || w < std::numeric_limits<weight_t>::min() || w > std::numeric_limits<weight_t>::max())) {
+                error = true; return false;
+            }
+            skipline();
+            e = edge(index_t(u), index_t(v), weight_t(w));
+            return true;
+        }
+    }
+
+private:
+    static bool isspace(char c) { return c == ' ' || c == '\t' || c == '\r' || c == '\n'; }
+    static bool isdigit(char c) { return '0' <= c && c <= '9'; }
+
+    /**< @brief 未読部分が1行の最大長より短ければ、緩衝領域の先頭に詰めて続きを読む */
+    void fill()
+    {
+        if (eof || len - pos >= buf.size() / 2) { return; }
+        std::memmove(buf.data(), buf.data() + pos, len - pos);
+        len -= pos; pos = 0;
+        len += std::fread(buf.data() + len, 1, buf.size() - len, fp);
+        if (len < buf.size()) { eof = true; }
+    }
+
+    void skipline()
+    {
+        while (true) {
+            while (pos < len && buf[pos] != '\n') { pos++; }
+            if (pos < len || eof) { break; }
+            fill();
+        }
+        if (pos < len) { pos++; }
+    }
+
+    /**< @brief 符号付き10進整数を読む. 数字がないか、std::int64_tで表せなければfalseを返す */
+    bool number(std::int64_t& x)
+    {
+        while (pos < len && (buf[pos] == ' ' || buf[pos] == '\t')) { pos++; }
+        bool neg = pos < len && buf[pos] == '-';
+        if (neg) { pos++; }
+        if (pos == len || !isdigit(buf[pos])) { return false; }
+        x = 0;
+        while (pos < len && isdigit(buf[pos])) {
+            int d = buf[pos++] - '0';
+            if (x > (INT64_MAX - d) / 10) { return false; }  // 桁あふれ
+            x = 10 * x + d;
+        }
+        if (neg) { x = -x; }
+        return true;
+    }
+};
+
+
+/**
+ * @brief  テキストの辺リストをCSRファイルに変換する
+ *
+ * @note   入力を2回読む. 1回目に各頂点の出次数と重みの有無を数えてoffsetsを決め、出力ファイルを最終的な大きさで作る
+ *         2回目に各辺(u, v)をtargets[pos[u]++]に書き込む. 出力ファイルはmmapで書き込み可能に写像するので、
+ *         書き込んだページはカーネルがファイルに書き戻す. 従って、プロセスが確保する記憶量はΘ(V)(出次数とposの配列)と
+ *         一定の大きさの緩衝領域だけであり、辺の数には依存しない. 同じ始点を持つ辺の順序は保存される
+ *
+ * @note   入力は2回読むので、標準入力やパイプではなく通常のファイルでなければならない
+ *         頂点数は辺に現れる最大の頂点番号 + 1とする. ただし、nがそれより大きければnとする
+ *         いずれかの行が重みを持てば重み付きのファイルを、そうでなければ重みを持たないファイルを作る
+ *
+ * @param  const std::string& input  辺リストのファイル名
+ * @param  const std::string& output CSRファイルのファイル名
+ * @param  std::int64_t       n      頂点数の下限
+ * @return 変換できたか否か
+ */
+inline bool convertedgelist(const std::string& input, const std::string& output, std::int64_t n = 0)
+{
+    std::FILE* fp = std::fopen(input.c_str(), "rb");
+    if (!fp) { return false; }
+
+    // 1回目 : 出次数を数える
+    offsets_t offsets(1, 0);
+    std::int64_t m = 0; bool weighted = false;
+    {
+        edgelistreader R(fp);
+        edge e; bool hasw;
+        while (R.next(e, hasw)) {
+            std::int64_t k = std::max<std::int64_t>(e.src, e.dst) + 2;
+            if (std::int64_t(offsets.size()) < k) { offsets.resize(k, 0); }
+            offsets[e.src + 1]++; m++; weighted = weighted || hasw;
+        }
+        if (R.error) { std::fclose(fp); return false; }
+    }
+    if (std::int64_t(offsets.size()) < n + 1) { offsets.resize(n + 1, 0); }
+    n = offsets.size() - 1;
+    for (std::int64_t u = 0; u < n; u++) { offsets[u + 1] += offsets[u]; }
+
+    // 出力ファイルを最終的な大きさで作り、写像する
+    csrlayout L(n, m, weighted);
+    int fd = ::open(output.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) { std::fclose(fp); return false; }
+    if (::ftruncate(fd, L.size) != 0) { ::close(fd); std::fclose(fp); return false; }
+    void* p = ::mmap(nullptr, L.size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (p == MAP_FAILED) { std::fclose(fp); return false; }
+    char* c = static_cast<char*>(p);
+    csrheader h = { { 'C', 'S', 'R', 'G' }, csrversion, weighted ? csrweighted : 0, 0, n, m };
+    std::memcpy(c, &h, sizeof(h));
+    std::memcpy(c + L.offsets, offsets.data(), sizeof(offset_t) * (n + 1));
+    index_t*  targets = reinterpret_cast<index_t*>(c + L.targets);
+    weight_t* weights = reinterpret_cast<weight_t*>(c + L.weights);
+
+    // 2回目 : 各辺を始点の隣接リストの末尾に書き込む
+    offsets.pop_back();  // offsets[u]をAdj[u]の次の書き込み位置posとして使う
+    std::rewind(fp);
+    edgelistreader R(fp);
+    edge e; bool hasw;
+    std::int64_t k = 0;
+    while (R.next(e, hasw)) {
+        if (e.src >= n || e.dst >= n || ++k > m) { R.error = true; break; }  // 1回目と内容が異なる
+        offset_t i = offsets[e.src]++;
+        targets[i] = e.dst;
+        if (weighted) { weights[i] = e.w; }
+    }
+    std::fclose(fp);
+    bool ok = !R.error && ::msync(p, L.size, MS_SYNC) == 0;
+    ::munmap(p, L.size);
+    return ok;
+}
+
+
+
+#endif  // end of __CSRFILE_HPP__
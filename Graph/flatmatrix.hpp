@@ -0,0 +1,122 @@
+/**
+ * @brief  1本の整列された配列に格納する正方行列
+ *
+ * @note   matrix_t(std::vector<std::vector<T>>)は行ごとに別々のヒープ領域を持つので、行と行がメモリ上で離れており、
+ *         行の先頭の整列も保証されない. 行列全体を走査する密なアルゴリズム(Floyd-Warshallなど)では、
+ *         行列を1本の配列に行優先で格納し、各行の先頭をキャッシュライン境界に揃えたほうがよい
+ *
+ * @note   n x n行列を、行の長さ(stride)をalign要素の倍数に切り上げたdim x dimの領域に格納する(dim = stride)
+ *         余白の要素は、アルゴリズム側で無害な値(例えば対角成分0, 非対角成分∞)に初期化しておく
+ *
+ * @date   2026/10/15
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef __FLATMATRIX_HPP__
+#define __FLATMATRIX_HPP__
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief  先頭をAlignバイト境界に揃えて記憶領域を確保するアロケータ
+ * @tparam T     要素の型
+ * @tparam Align 整列の単位(バイト数, 2の冪)
+ */
+template <class T, std::size_t Align = 64>
+struct alignedalloc {
+    using value_type = T;
+    template <class U> struct rebind { using other = alignedalloc<U, Align>; };
+
+    alignedalloc() = default;
+    template <class U> alignedalloc(const alignedalloc<U, Align>&) {}
+
+    T* allocate(std::size_t n)
+    {
+        void* p = nullptr;
+        if (posix_memalign(&p, Align, n * sizeof(T)) != 0) { throw std::bad_alloc(); }
+        return static_cast<T*>(p);
+    }
+
+    void deallocate(T* p, std::size_t)
+    {
+        std::free(p);
+    }
+
+    template <class U> bool operator==(const alignedalloc<U, Align>&) const { return true;  }
+    template <class U> bool operator!=(const alignedalloc<U, Align>&) const { return false; }
+};
+
+
+/**
+ * @brief  n x nの正方行列
+ * @tparam T 要素の型
+ */
+template <class T>
+struct flatmatrix {
+    enum { align = 64 / sizeof(T) > 0 ? 64 / sizeof(T) : 1 };  /**< 行の長さを揃える単位(1キャッシュライン分の要素数) */
+
+    std::int32_t n;                            /**< 行列の大きさ */
+    std::int32_t dim;                          /**< 余白を含めた行の長さ */
+    std::vector<T, alignedalloc<T>> a;         /**< 行優先で格納した要素 */
+
+    flatmatrix() : n(0), dim(0) {}
+
+    /**
+     * @brief  すべての要素がxであるn x n行列を作る
+     */
+    flatmatrix(std::int32_t n, const T& x)
+        : n(n), dim((n + align - 1) / align * align), a(std::size_t(dim) * dim, x) {}
+
+    /**
+     * @brief  行列の行の配列Mを複写する. 余白の要素はxとする
+     */
+    flatmatrix(const std::vector<std::vector<T>>& M, const T& x) : flatmatrix(M.size(), x)
+    {
+        for (std::int32_t i = 0; i < n; i++) { std::copy(M[i].begin(), M[i].end(), row(i)); }
+    }
+
+    /**< @brief 余白を除いた行の配列に変換する */
+    std::vector<std::vector<T>> tomatrix() const
+    {
+        std::vector<std::vector<T>> M(n);
+        for (std::int32_t i = 0; i < n; i++) { M[i].assign(row(i), row(i) + n); }
+        return M;
+    }
+
+    /**< @brief 行列の大きさnを返す */
+    std::int32_t size() const { return n; }
+
+    /**< @brief 第i行の先頭を返す */
+    T*       row(std::int32_t i)       { return a.data() + std::size_t(i) * dim; }
+    const T* row(std::int32_t i) const { return a.data() + std::size_t(i) * dim; }
+
+    /**< @brief (i, j)要素を返す */
+    T&       operator()(std::int32_t i, std::int32_t j)       { return row(i)[j]; }
+    const T& operator()(std::int32_t i, std::int32_t j) const { return row(i)[j]; }
+};
+
+
+
+#endif  // end of __FLATMATRIX_HPP__
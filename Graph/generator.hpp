@@ -0,0 +1,178 @@
+/**
+ * @brief  ベンチマーク用の合成グラフの生成器
+ *
+ * @note   いずれの生成器も辺リストedges_tを返す. csrgraph(n, E)やgraph_tへの変換は呼び出し側で行う
+ *         乱数はstd::mt19937の出力だけから(標準ライブラリの分布を介さずに)作るので、
+ *         同じ種からは処理系によらず同じグラフが得られる
+ *
+ * @note   生成するグラフは有向であり、自己ループや多重辺を含むことがある. 無向グラフが必要ならばsymmetrizeを用いる
+ *
+ * @date   2026/10/15
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef __GENERATOR_HPP__
+#define __GENERATOR_HPP__
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "graph.hpp"
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**< @brief [0, n)の一様乱数(乗算とシフトによる) */
+inline index_t uniformindex(std::mt19937& mt, std::int64_t n)
+{
+    return index_t((std::uint64_t(mt()) * std::uint64_t(n)) >> 32);
+}
+
+/**< @brief [0, 1)の一様乱数 */
+inline double uniformreal(std::mt19937& mt)
+{
+    return mt() * (1.0 / 4294967296.0);
+}
+
+
+/**
+ * @brief  R-MAT(Kronecker)グラフを生成する
+ * @note   2^scale x 2^scaleの隣接行列を4つの象限に分け、確率a, b, c, 1 - a - b - cで1つを選ぶことをscale回繰り返して1辺を置く
+ *         Graph500の既定値(a, b, c) = (0.57, 0.19, 0.19)では、次数分布が裾の重いべき乗則に従い、直径の小さいグラフになる
+ *         頂点番号と次数の相関を消すため、最後に頂点番号を無作為に置換する
+ * @param  std::int32_t scale      頂点数の対数lg|V|
+ * @param  std::int32_t edgefactor 平均出次数|E| / |V|
+ */
+inline edges_t rmat(std::int32_t scale, std::int32_t edgefactor, std::mt19937& mt,
+                    double a = 0.57, double b = 0.19, double c = 0.19)
+{
+    std::int64_t n = std::int64_t(1) << scale, m = n * edgefactor;
+    edges_t E; E.reserve(m);
+    for (std::int64_t i = 0; i < m; i++) {
+        index_t u = 0, v = 0;
+        for (std::int32_t k = 0; k < scale; k++) {
+            double r = uniformreal(mt);
+            index_t bu = r >= a + b, bv = (r >= a && r < a + b) || r >= a + b + c;
+            u = (u << 1) | bu; v = (v << 1) | bv;
+        }
+        E.emplace_back(u, v);
+    }
+    indices_t perm(n);
+    for (index_t v = 0; v < n; v++) { perm[v] = v; }
+    for (std::int64_t i = n - 1; i > 0; i--) { std::swap(perm[i], perm[uniformindex(mt, i + 1)]); }
+    for (auto& e : E) { e.src = perm[e.src]; e.dst = perm[e.dst]; }
+    return E;
+}
+
+
+/**
+ * @brief  rows x colsの2次元格子グラフを生成する
+ * @note   各頂点から上下左右の隣接頂点へ辺を張る(両方向). 道路網に近い、直径Θ(rows + cols)の疎なグラフである
+ *         頂点(i, j)の番号はi * cols + jである
+ */
+inline edges_t grid2d(std::int32_t rows, std::int32_t cols)
+{
+    edges_t E; E.reserve(4 * std::int64_t(rows) * cols);
+    for (index_t i = 0; i < rows; i++) {
+        for (index_t j = 0; j < cols; j++) {
+            index_t u = i * cols + j;
+            if (j + 1 < cols) { E.emplace_back(u, u + 1);    E.emplace_back(u + 1, u); }
+            if (i + 1 < rows) { E.emplace_back(u, u + cols); E.emplace_back(u + cols, u); }
+        }
+    }
+    return E;
+}
+
+
+/**
+ * @brief  Erdős–RényiのランダムグラフG(n, m)を生成する
+ * @note   m本の辺の始点と終点をそれぞれ独立に一様に選ぶ. 次数分布は平均m / nのPoisson分布に近い
+ */
+inline edges_t erdosrenyi(std::int32_t n, std::int64_t m, std::mt19937& mt)
+{
+    edges_t E; E.reserve(m);
+    for (std::int64_t i = 0; i < m; i++) {
+        index_t u = uniformindex(mt, n), v = uniformindex(mt, n);
+        E.emplace_back(u, v);
+    }
+    return E;
+}
+
+
+/**
+ * @brief  次数分布がべき乗則に従うランダムグラフ(Chung-Luモデル)を生成する
+ * @note   頂点iに重みw_i = (i + 1)^(-1 / (gamma - 1))を与え、各辺の始点と終点をそれぞれ重みに比例する確率で選ぶ
+ *         頂点iの期待次数はw_iに比例するので、次数分布は指数gammaのべき乗則に従う
+ *         重みの累積和を2分探索して頂点を選ぶので、1辺あたりΟ(lg V)時間である
+ * @param  double gamma べき指数(2 < gamma < 3で現実のネットワークに近い)
+ */
+inline edges_t powerlaw(std::int32_t n, std::int64_t m, double gamma, std::mt19937& mt)
+{
+    std::vector<double> cdf(n);
+    double sum = 0.0;
+    for (index_t i = 0; i < n; i++) { sum += std::pow(i + 1.0, -1.0 / (gamma - 1.0)); cdf[i] = sum; }
+    auto pick = [&]() -> index_t {
+        auto it = std::upper_bound(cdf.begin(), cdf.end(), uniformreal(mt) * sum);
+        return index_t(std::min<std::ptrdiff_t>(it - cdf.begin(), n - 1));
+    };
+    edges_t E; E.reserve(m);
+    for (std::int64_t i = 0; i < m; i++) {
+        index_t u = pick(), v = pick();
+        E.emplace_back(u, v);
+    }
+    return E;
+}
+
+
+/**
+ * @brief  各辺の重み(容量)を[lo, hi]の一様乱数とする
+ */
+inline void randomweights(edges_t& E, weight_t lo, weight_t hi, std::mt19937& mt)
+{
+    for (auto& e : E) { e.w = lo + uniformindex(mt, std::int64_t(hi) - lo + 1); }
+}
+
+
+/**
+ * @brief  各辺(u, v)に同じ重みの逆向きの辺(v, u)を加え、自己ループを取り除く(無向グラフとして扱うため)
+ */
+inline edges_t symmetrize(const edges_t& E)
+{
+    edges_t F; F.reserve(2 * E.size());
+    for (auto& e : E) {
+        if (e.src == e.dst) { continue; }
+        F.push_back(e); F.emplace_back(e.dst, e.src, e.w);
+    }
+    return F;
+}
+
+
+/**
+ * @brief  辺リストから隣接リスト表現graph_tを構築する
+ */
+inline graph_t tograph(std::int32_t n, const edges_t& E)
+{
+    graph_t G(n);
+    for (auto& e : E) { G[e.src].push_back(e); }
+    return G;
+}
+
+
+
+#endif  // end of __GENERATOR_HPP__
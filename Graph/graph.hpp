@@ -64,6 +64,8 @@
 // 必要なヘッダファイルのインクルード
 //****************************************
 
+#include <cstdint>
+#include <limits>
 #include <utility>
 #include <algorithm>
 #include <vector>
@@ -103,6 +105,7 @@ enum struct color : std::int32_t {
 
 /**
  * @brief グラフ用ノード(頂点) 
+ * @note  頂点の属性を属性ごとの配列で保持する場合はvertexstate(vertexstate.hpp)を用いる
  */
 struct vertex {
     union {
@@ -0,0 +1,238 @@
+/**
+ * @brief  参照の局所性を高めるための頂点の番号の付け替え(reordering)を扱う
+ *
+ * @note   graph_tやcsrgraphの頂点番号は入力の順のままなので、隣接する頂点の属性(vertices_tの要素など)は
+ *         メモリ上に散らばり、探索のたびにキャッシュミスが起こる. 隣接する頂点に近い番号を付け直せば、
+ *         同じアルゴリズムをそのまま実行するだけで、連続したメモリを読む割合が増える
+ *
+ * @note   順列permはperm[v] = (元の頂点vの新しい番号)で表す. 使い方は次のとおりである
+ *           indices_t perm = rcmorder(G);            // 1. 順列を求め、
+ *           csrgraph  H    = permute(G, perm);       // 2. 番号を付け替えたグラフを作り、
+ *           vertices_t V   = bfs(H, perm[s]);        // 3. 始点などの頂点番号も付け替えて実行し、
+ *           V = unpermute(V, perm);                  // 4. 結果を元の番号に戻す
+ *
+ * @date   2026/10/15
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef __REORDER_HPP__
+#define __REORDER_HPP__
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+#include "graph.hpp"
+#include "csr.hpp"
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**
+ * @brief  新しい番号の順に並べた元の頂点の列order(order[i] = 新しい番号がiの頂点)を順列permに変換する
+ */
+inline indices_t toperm(const indices_t& order)
+{
+    indices_t perm(order.size());
+    for (std::size_t i = 0; i < order.size(); i++) { perm[order[i]] = index_t(i); }
+    return perm;
+}
+
+
+/**
+ * @brief  順列permの逆順列(inv[perm[v]] = v)を返す
+ */
+inline indices_t inverse(const indices_t& perm)
+{
+    return toperm(perm);
+}
+
+
+/**
+ * @brief  出次数の非増加順に番号を付ける(次数の等しい頂点は元の番号順)
+ * @note   次数の大きい頂点ほど多くの辺から参照されるので、それらを配列の先頭にまとめてキャッシュに載せておく
+ *         べき乗則に従うグラフでは、少数のハブ頂点が参照の大部分を占めるので効果が大きい. 実行時間はΟ(VlgV + E)である
+ */
+template <class Graph>
+indices_t degreeorder(const Graph& G)
+{
+    std::int32_t n = G.size();
+    indices_t order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&G](index_t u, index_t v) { return G[u].size() > G[v].size(); });
+    return toperm(order);
+}
+
+
+/**
+ * @brief  幅優先探索で頂点を訪れた順に番号を付ける
+ * @note   同じ頂点の隣接頂点(共通の隣接頂点を持つ頂点)が連続した番号になり、探索の各段も連続した範囲を占める
+ *         Gorderのように共通の隣接頂点の数を明示的に最大化するわけではないが、その安価な近似としてよく用いられる
+ *         始点は出次数が最大の未訪問の頂点とし、すべての頂点を訪れるまで探索を繰り返す. 実行時間はΟ(VlgV + E)である
+ */
+template <class Graph>
+indices_t bfsorder(const Graph& G)
+{
+    std::int32_t n = G.size();
+    indices_t roots(n), order; order.reserve(n);
+    std::iota(roots.begin(), roots.end(), 0);
+    std::stable_sort(roots.begin(), roots.end(), [&G](index_t u, index_t v) { return G[u].size() > G[v].size(); });
+    std::vector<std::uint8_t> visited(n, 0);
+    for (index_t r : roots) {
+        if (visited[r]) { continue; }
+        visited[r] = 1; std::size_t head = order.size();
+        order.push_back(r);  // orderの未処理の部分をFIFOキューとして用いる
+        while (head < order.size()) {
+            index_t u = order[head++];
+            for (const auto& e : G[u]) {
+                if (!visited[e.dst]) { visited[e.dst] = 1; order.push_back(e.dst); }
+            }
+        }
+    }
+    return toperm(order);
+}
+
+
+/**
+ * @brief  逆Cuthill-McKee法(reverse Cuthill-McKee)で番号を付ける
+ *
+ * @note   Cuthill-McKee法は、擬似周辺頂点(pseudo-peripheral vertex)から幅優先探索を行い、各頂点の未訪問の隣接頂点を
+ *         次数の昇順に訪れた順に番号を付ける. 最後に順序を逆にすると、隣接行列の帯幅(|perm[u] - perm[v]|の最大値)と
+ *         プロファイルが小さくなる. 各辺の両端点の番号が近くなるので、探索の局所性が高まる
+ *
+ * @note   擬似周辺頂点はGeorge-Liuの方法で求める. 未訪問の頂点のうち次数最小の頂点rから幅優先探索を行い、
+ *         最後の段のうち次数最小の頂点xの離心率がrより大きければ、rをxに替えて繰り返す
+ *
+ * @note   有向グラフでは出辺だけを辿る(対称な隣接行列を仮定する本来の方法とは異なり、出辺でつながる頂点を近づける)
+ *         実行時間は擬似周辺頂点の探索の反復回数をkとして、Ο(kE + ElgV)である
+ */
+template <class Graph>
+indices_t rcmorder(const Graph& G)
+{
+    std::int32_t n = G.size();
+    auto smaller = [&G](index_t u, index_t v) { return G[u].size() < G[v].size(); };
+    indices_t roots(n), order, level(n, graph::nil), Q; order.reserve(n); Q.reserve(n);
+    std::iota(roots.begin(), roots.end(), 0);
+    std::stable_sort(roots.begin(), roots.end(), smaller);
+    std::vector<std::uint8_t> visited(n, 0);
+
+    // 未訪問の頂点だけを通ってrから幅優先探索を行い、最後の段のうち次数最小の頂点とrの離心率を返す
+    auto eccentricity = [&](index_t r) -> std::pair<index_t, index_t> {
+        Q.clear(); Q.push_back(r); level[r] = 0;
+        for (std::size_t head = 0; head < Q.size(); head++) {
+            index_t u = Q[head];
+            for (const auto& e : G[u]) {
+                if (!visited[e.dst] && level[e.dst] == graph::nil) { level[e.dst] = level[u] + 1; Q.push_back(e.dst); }
+            }
+        }
+        index_t ecc = level[Q.back()], x = Q.back();
+        for (auto it = Q.rbegin(); it != Q.rend() && level[*it] == ecc; ++it) { x = smaller(*it, x) ? *it : x; }
+        for (index_t v : Q) { level[v] = graph::nil; }
+        return std::make_pair(x, ecc);
+    };
+
+
+    for (index_t r : roots) {
+        if (visited[r]) { continue; }
+        auto p = eccentricity(r);
+        for (std::int32_t k = 0; k < 8; k++) {  // 擬似周辺頂点を探す(反復回数には上限を設ける)
+            auto q = eccentricity(p.first);
+            if (q.second <= p.second) { break; }
+            r = p.first; p = q;
+        }
+        // Cuthill-McKee法: rから幅優先探索を行い、未訪問の隣接頂点を次数の昇順に訪れる
+        visited[r] = 1; std::size_t head = order.size();
+        order.push_back(r);
+        while (head < order.size()) {
+            index_t u = order[head++];
+            std::size_t first = order.size();
+            for (const auto& e : G[u]) {
+                if (!visited[e.dst]) { visited[e.dst] = 1; order.push_back(e.dst); }
+            }
+            std::stable_sort(order.begin() + first, order.end(), smaller);
+        }
+    }
+    std::reverse(order.begin(), order.end());
+    return toperm(order);
+}
+
+
+/**
+ * @brief  頂点vの番号をperm[v]に付け替えたグラフを返す
+ * @note   新しい頂点perm[u]の隣接リストは、元の隣接リストAdj[u]の各辺(u, v, w)を(perm[u], perm[v], w)に置き換えたものである
+ *         辺の重み(容量)は辺とともに移り、隣接リスト内の辺の順序は保存される. 実行時間はΘ(V + E)である
+ */
+inline graph_t permute(const graph_t& G, const indices_t& perm)
+{
+    std::int32_t n = G.size();
+    graph_t H(n);
+    for (index_t u = 0; u < n; u++) {
+        auto& adj = H[perm[u]]; adj.reserve(G[u].size());
+        for (const auto& e : G[u]) { adj.emplace_back(perm[u], perm[e.dst], e.w); }
+    }
+    return H;
+}
+
+inline csrgraph permute(const csrgraph& G, const indices_t& perm)
+{
+    std::int32_t n = G.size();
+    csrgraph H; H.offsets.assign(n + 1, 0);
+    for (index_t u = 0; u < n; u++) { H.offsets[perm[u] + 1] = G.degree(u); }
+    for (index_t u = 0; u < n; u++) { H.offsets[u + 1] += H.offsets[u]; }
+    H.targets.resize(G.edges()); H.weights.resize(G.edges());
+    for (index_t u = 0; u < n; u++) {
+        offset_t i = H.offsets[perm[u]];
+        for (offset_t j = G.offsets[u]; j < G.offsets[u + 1]; j++, i++) {
+            H.targets[i] = perm[G.targets[j]]; H.weights[i] = G.weights[j];
+        }
+    }
+    return H;
+}
+
+
+/**
+ * @brief  番号を付け替えたグラフ上で求めた頂点の属性Xを元の番号に戻す(X'[v] = X[perm[v]])
+ * @note   値そのものが頂点番号である属性(先行点など)は、unpermute(vertices_t)のように値も戻す必要がある
+ */
+template <class T>
+std::vector<T> unpermute(const std::vector<T>& X, const indices_t& perm)
+{
+    std::int32_t n = perm.size();
+    std::vector<T> Y(n);
+    for (index_t v = 0; v < n; v++) { Y[v] = X[perm[v]]; }
+    return Y;
+}
+
+/**
+ * @brief  番号を付け替えたグラフ上で求めた頂点集合を元の番号に戻す
+ * @note   各頂点のd値と色はそのまま移し、先行点v.πは逆順列によって元の番号に戻す
+ */
+inline vertices_t unpermute(const vertices_t& V, const indices_t& perm)
+{
+    std::int32_t n = perm.size();
+    indices_t  inv = inverse(perm);
+    vertices_t W(n);
+    for (index_t v = 0; v < n; v++) {
+        W[v] = V[perm[v]];
+        if (W[v].pi != graph::nil) { W[v].pi = inv[W[v].pi]; }
+    }
+    return W;
+}
+
+
+
+#endif  // end of __REORDER_HPP__
@@ -0,0 +1,100 @@
+/**
+ * @brief  疎な残余ネットワーク(residual network)の表現
+ *
+ * @note   edmondskarpとfordfulkersonは容量cとフローfを|V| x |V|の行列で持つので、記憶量がΘ(V^2)である
+ *         ここでは、各辺(u, v) ∈ Eに対して残余辺(u, v)と逆向きの残余辺(v, u)の組を作り、
+ *         各残余辺に残余容量cfと対になる辺の添字revを持たせる. これによって、フローを流す操作
+ *           (u, v).cf -= δ, (v, u).cf += δ
+ *         は隣接行列を引かずにΟ(1)時間で行え、記憶量はΘ(V + E)になる
+ *
+ * @note   残余辺はCSR形式(csrgraphと同じ)で頂点ごとに連続して格納する
+ *
+ * @date   2026/10/15
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef __RESIDUAL_HPP__
+#define __RESIDUAL_HPP__
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <cstdint>
+#include <vector>
+#include "graph.hpp"
+#include "csr.hpp"
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief  残余辺
+ */
+struct residualarc {
+    index_t    dst;  /**< 辺の終点 */
+    capacity_t cf;   /**< 残余容量 */
+    offset_t   rev;  /**< 逆向きの残余辺の添字 */
+};
+
+
+/**
+ * @brief  残余ネットワークGf
+ */
+struct residualgraph {
+    offsets_t                offsets;  /**< 頂点uの残余辺はarcs[offsets[u]..offsets[u+1]-1]である */
+    std::vector<residualarc> arcs;     /**< 残余辺 */
+    offsets_t                forward;  /**< 入力のi番目の辺(u, v)に対応する残余辺(u, v)の添字 */
+
+    residualgraph() : offsets(1, 0) {}
+
+    /**
+     * @brief  フローネットワークG = (V, E)のゼロフローに対する残余ネットワークを構築する
+     * @note   各辺の容量はedge::cである. 辺(u, v)と(v, u)がともにEに含まれていてもよい(残余辺はそれぞれ別に作る)
+     *         実行時間はΘ(V + E)である
+     * @param  std::int32_t   n 頂点数|V|
+     * @param  const edges_t& E 辺集合E
+     */
+    residualgraph(std::int32_t n, const edges_t& E) : offsets(n + 1, 0), arcs(2 * E.size()), forward(E.size())
+    {
+        for (auto& e : E) { offsets[e.src + 1]++; offsets[e.dst + 1]++; }
+        for (index_t u = 0; u < n; u++) { offsets[u + 1] += offsets[u]; }
+        offsets_t pos(offsets.begin(), offsets.end() - 1);
+        for (std::size_t i = 0; i < E.size(); i++) {
+            const edge& e = E[i];
+            offset_t a = pos[e.src]++, b = pos[e.dst]++;
+            arcs[a] = residualarc{ e.dst, e.c, b };  // 残余辺(u, v)の残余容量はc(u, v)であり、
+            arcs[b] = residualarc{ e.src, 0,   a };  // 逆向きの残余辺(v, u)の残余容量は0である
+            forward[i] = a;
+        }
+    }
+
+    /**< @brief 頂点数|V|を返す */
+    std::size_t size() const { return offsets.size() - 1; }
+
+    /**< @brief 頂点uの最初の残余辺の添字を返す */
+    offset_t begin(index_t u) const { return offsets[u]; }
+
+    /**< @brief 頂点uの最後の残余辺の次の添字を返す */
+    offset_t end(index_t u) const { return offsets[u + 1]; }
+
+    /**< @brief 残余辺aにδだけフローを流す */
+    void push(offset_t a, capacity_t delta)
+    {
+        arcs[a].cf -= delta; arcs[arcs[a].rev].cf += delta;
+    }
+};
+
+
+
+#endif  // end of __RESIDUAL_HPP__
@@ -0,0 +1,116 @@
+/**
+ * @brief  頂点の属性(d, π, 色)を属性ごとの配列で保持する頂点状態(structure of arrays)
+ *
+ * @note   vertices_tは頂点ごとに(d, π, 色)を1つの12バイトの構造体にまとめる(array of structures)
+ *         Dijkstraのアルゴリズムの緩和はv.dと色しか読まないが、vの構造体全体がキャッシュ行に載るので、
+ *         使わないv.πも一緒に読み込まれ、1本のキャッシュ行に入る頂点の数は5個程度になる
+ *         vertexstateは属性ごとに配列を分け、色は1バイトで持つ. 緩和が触れるのはd(4バイト)と色(1バイト)の配列だけで、
+ *         1本のキャッシュ行にdなら16頂点分、色なら64頂点分が入る. πは緩和に成功したときだけ書き込まれる
+ *
+ * @note   色を1ビットではなく1バイトにするのは、白・灰・黒の3値を表すためと、ビットの書き込みが同じ語の
+ *         読み出し・変更・書き込みになって並列に書き込めないためである(訪問済みか否かだけならばbitmapを用いる)
+ *
+ * @note   アルゴリズムはS.d[v], S.pi[v]のように属性の配列を直接読み書きし、色はcolorof(v)とpaint(v, c)で扱う
+ *         vertices_tへはtovertices()(または暗黙の変換)で変換できるので、vertices_tを返す既存の関数はそのまま使える
+ *           vertexstate S(G.size());
+ *           dijkstra(G, s, S);          // 同じSを始点ごとに使い回せば、頂点の属性の確保は1度で済む
+ *           vertices_t V = S;           // 従来の表現が必要な場合に限り変換する
+ *
+ * @date   2026/10/15
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef __VERTEXSTATE_HPP__
+#define __VERTEXSTATE_HPP__
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include "graph.hpp"
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief  頂点の属性の配列の組
+ */
+struct vertexstate {
+    using state_t = std::uint8_t;
+
+    array_t              d;      /**< 始点sからの距離(Primのアルゴリズムではキー) */
+    indices_t            pi;     /**< 先行頂点(の添字) */
+    std::vector<state_t> state;  /**< 頂点の色(colorの値を1バイトで持つ) */
+
+    vertexstate() = default;
+
+    /**
+     * @brief  n頂点の状態を、すべての頂点がd = ∞, π = NIL, 白である状態に初期化する
+     */
+    explicit vertexstate(std::int32_t n) : d(n, graph::inf), pi(n, graph::nil), state(n, white()) {}
+
+    /**
+     * @brief  頂点集合Vから構築する
+     */
+    explicit vertexstate(const vertices_t& V) : d(V.size()), pi(V.size()), state(V.size())
+    {
+        std::int32_t n = V.size();
+        for (index_t v = 0; v < n; v++) { d[v] = V[v].d; pi[v] = V[v].pi; state[v] = state_t(V[v].color); }
+    }
+
+    /**< @brief 頂点の数を返す */
+    std::size_t size() const { return d.size(); }
+
+    /**< @brief 頂点vの色を返す */
+    color colorof(index_t v) const { return color(state[v]); }
+
+    /**< @brief 頂点vを色cに彩色する */
+    void paint(index_t v, color c) { state[v] = state_t(c); }
+
+    /**
+     * @brief  頂点の数をnにし、すべての頂点をd = ∞, π = NIL, 白に戻す
+     * @note   頂点の数が変わらなければメモリを確保し直さない
+     */
+    void reset(std::int32_t n)
+    {
+        d.assign(n, graph::inf); pi.assign(n, graph::nil); state.assign(n, white());
+    }
+
+    /**< @brief 頂点vの属性をvertexとして返す */
+    vertex operator [] (index_t v) const
+    {
+        vertex x; x.d = d[v]; x.pi = pi[v]; x.color = colorof(v);
+        return x;
+    }
+
+    /**< @brief 頂点集合V(array of structures)に変換する */
+    vertices_t tovertices() const
+    {
+        std::int32_t n = size();
+        vertices_t V(n);
+        for (index_t v = 0; v < n; v++) { V[v] = (*this)[v]; }
+        return V;
+    }
+
+    operator vertices_t () const { return tovertices(); }
+
+private:
+    static state_t white() { return state_t(color::white); }
+};
+
+
+
+#endif  // end of __VERTEXSTATE_HPP__
@@ -0,0 +1,78 @@
+/**
+ * @brief  グラフ探索の事象(event)を受け取る訪問者(visitor)を扱う
+ *
+ * @note   bfs, dfs, dijkstra, bellmanford, primは、探索の各事象(頂点の発見、辺の吟味、緩和、頂点の終了など)で
+ *         訪問者の同名のメンバ関数を呼び出す. 訪問者の型はテンプレート引数なので、呼び出しは静的に解決されてインライン展開される
+ *         std::functionを介した間接呼び出しと異なり、何もしない事象は完全に消え、探索の最内ループに呼び出しの費用は残らない
+ *
+ * @note   利用者の訪問者はnullvisitorを継承し、必要な事象のメンバ関数だけを同じ名前で定義する(仮想関数ではなく名前の隠蔽による)
+ *           struct counter : nullvisitor {
+ *               std::int64_t edges = 0;
+ *               void examine_edge(const edge&) { edges++; }
+ *           };
+ *           counter c; bfs(G, s, c);  // c.edgesは吟味した辺の数
+ *         訪問者は参照で渡されるので、探索の後に訪問者の状態を読める. 一時オブジェクトを渡してもよい
+ *
+ * @note   各アルゴリズムが呼び出す事象は次のとおりである(○は呼び出す事象)
+ *
+ *           事象                    bfs  dfs  dijkstra  bellmanford  prim
+ *           initialize_vertex(u)     ○    ○     ○          ○         ○    頂点uを初期化した
+ *           start_vertex(u)               ○                                  uを深さ優先木の根として探索を始める
+ *           discover_vertex(u)       ○    ○     ○                    ○    uを初めて発見した(灰に彩色した)
+ *           examine_vertex(u)        ○          ○                    ○    uをキューから取り出した
+ *           examine_edge(e)          ○    ○     ○          ○         ○    辺eを吟味する
+ *           tree_edge(e)             ○    ○                                  eは探索木の辺である
+ *           non_tree_edge(e)         ○                                       eは探索木の辺ではない
+ *           back_edge(e)                  ○                                  eは後退辺である
+ *           forward_or_cross_edge(e)      ○                                  eは前進辺または横断辺である
+ *           edge_relaxed(e)                     ○          ○         ○    eの緩和によって推定値(キー)が減少した
+ *           edge_not_relaxed(e)                 ○          ○         ○    eの緩和によって推定値(キー)が変化しなかった
+ *           finish_vertex(u)         ○    ○     ○                    ○    uの隣接リストを調べ終えた(黒に彩色した)
+ *
+ * @date   2026/10/15
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef __VISITOR_HPP__
+#define __VISITOR_HPP__
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include "graph.hpp"
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief  どの事象でも何もしない訪問者(利用者の訪問者の基底)
+ */
+struct nullvisitor {
+    void initialize_vertex(index_t) {}
+    void start_vertex(index_t) {}
+    void discover_vertex(index_t) {}
+    void examine_vertex(index_t) {}
+    void examine_edge(const edge&) {}
+    void tree_edge(const edge&) {}
+    void non_tree_edge(const edge&) {}
+    void back_edge(const edge&) {}
+    void forward_or_cross_edge(const edge&) {}
+    void edge_relaxed(const edge&) {}
+    void edge_not_relaxed(const edge&) {}
+    void finish_vertex(index_t) {}
+};
+
+
+
+#endif  // end of __VISITOR_HPP__
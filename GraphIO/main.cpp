@@ -0,0 +1,155 @@
+/**
+ * @brief  CSRファイルへの変換とメモリマップによる読み込みのテスト
+ *
+ * @note   csrconv input.txt output.csr : テキストの辺リストをCSRファイルに変換する
+ *         csrconv graph.csr            : CSRファイルを写像し、頂点数、辺数と頂点0からの最短路の統計を出力する
+ *         csrconv                      : ランダムなグラフで、変換・書き出し・写像が元のグラフと一致することを確かめる
+ *
+ * @date   2026/10/15
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include "../Graph/csrfile.hpp"
+#include "../Dijkstra/dijkstra.hpp"
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**
+ * @brief  2つのグラフの隣接リストが(辺の順序と重みを含めて)一致するか否かを返す
+ */
+template <class G1, class G2>
+bool equal(const G1& G, const G2& H)
+{
+    if (G.size() != H.size()) { return false; }
+    for (index_t u = 0; u < index_t(G.size()); u++) {
+        if (G[u].size() != H[u].size()) { return false; }
+        for (std::size_t i = 0; i < G[u].size(); i++) {
+            if (G[u][i].dst != H[u][i].dst || G[u][i].w != H[u][i].w) { return false; }
+        }
+    }
+    return true;
+}
+
+
+/**
+ * @brief  CSRファイルを写像し、頂点0からの最短路を求めて統計を出力する
+ */
+int stats(const char* path)
+{
+    auto start = std::chrono::steady_clock::now();
+    mappedcsr G;
+    if (!G.open(path)) { std::fprintf(stderr, "cannot map %s\n", path); return 1; }
+    if (!G.verify()) { std::fprintf(stderr, "broken csr file %s\n", path); return 1; }
+    if (G.size() == 0) { std::printf("0 vertices, 0 edges\n"); return 0; }  // 始点となる頂点0がない
+    auto mapped = std::chrono::steady_clock::now();
+    vertices_t V = dijkstra(G, 0);
+    auto stop = std::chrono::steady_clock::now();
+
+    std::int64_t reached = 0; weight_t far = 0;
+    for (auto& v : V) { if (v.d != graph::inf) { reached++; far = std::max(far, v.d); } }
+    std::printf("%ld vertices, %ld edges, %s\n", long(G.size()), long(G.edges()), G.weighted() ? "weighted" : "unweighted");
+    std::printf("open and verify %.3f ms, dijkstra %.3f ms, reached %ld, eccentricity %d\n",
+                std::chrono::duration<double, std::milli>(mapped - start).count(),
+                std::chrono::duration<double, std::milli>(stop - mapped).count(), long(reached), far);
+    return 0;
+}
+
+
+
+int main(int argc, char* argv[])
+{
+    if (argc == 3) {
+        if (!convertedgelist(argv[1], argv[2])) { std::fprintf(stderr, "cannot convert %s\n", argv[1]); return 1; }
+        return stats(argv[2]);
+    }
+    if (argc == 2) { return stats(argv[1]); }
+
+    // ランダムなグラフを辺リストとして書き出し、変換したCSRファイルが元のグラフと一致することを確かめる
+    const index_t n = 1 << 14; const std::int64_t m = 1 << 17;
+    std::mt19937 mt(1);
+    std::uniform_int_distribution<index_t>  vdist(0, n - 1);
+    std::uniform_int_distribution<weight_t> wdist(1, 100);
+    edges_t E;
+    std::FILE* fp = std::fopen("csrconv.txt", "w");
+    std::fprintf(fp, "# random graph\n");
+    for (std::int64_t i = 0; i < m; i++) {
+        E.emplace_back(vdist(mt), vdist(mt), wdist(mt));
+        std::fprintf(fp, "%d\t%d %d\n", E.back().src, E.back().dst, E.back().w);
+    }
+    std::fclose(fp);
+    csrgraph G(n, E);
+
+    mappedcsr H;
+    bool ok = convertedgelist("csrconv.txt", "csrconv.csr", n) && H.open("csrconv.csr") && equal(G, H);
+    std::printf("convert        : %s\n", ok ? "ok" : "ng");
+    ok = savecsr("csrconv.csr", G) && H.open("csrconv.csr") && equal(G, H) && H.weighted();
+    std::printf("save           : %s\n", ok ? "ok" : "ng");
+
+    vertices_t A = dijkstra(G, 0), B = dijkstra(H, 0);
+    ok = true;
+    for (index_t v = 0; v < n; v++) { ok = ok && A[v].d == B[v].d; }
+    std::printf("dijkstra       : %s\n", ok ? "ok" : "ng");
+
+    // 重みを持たないファイルでは、すべての辺の重みは1である
+    ok = savecsr("csrconv.csr", G, false) && H.open("csrconv.csr") && !H.weighted();
+    for (index_t u = 0; ok && u < n; u++) { for (const auto& e : H[u]) { ok = ok && e.w == 1; } }
+    std::printf("unweighted     : %s\n", ok ? "ok" : "ng");
+
+    // 中身の壊れたファイルは写像できても、verifyで検出する
+    ok = savecsr("csrconv.csr", G) && H.open("csrconv.csr") && H.verify();
+    H.close();
+    {
+        offset_t x = G.offsets[2] + 1; index_t y = n;
+        fp = std::fopen("csrconv.csr", "r+b");
+        std::fseek(fp, sizeof(csrheader) + sizeof(offset_t), SEEK_SET); std::fwrite(&x, sizeof(x), 1, fp);  // offsets[1] > offsets[2]
+        std::fclose(fp);
+        ok = ok && H.open("csrconv.csr") && !H.verify();
+        H.close();
+        savecsr("csrconv.csr", G);
+        fp = std::fopen("csrconv.csr", "r+b");
+        std::fseek(fp, csrlayout(n, m, true).targets, SEEK_SET); std::fwrite(&y, sizeof(y), 1, fp);       // 範囲外の終点
+        std::fclose(fp);
+        ok = ok && H.open("csrconv.csr") && !H.verify();
+        H.close();
+    }
+    std::printf("verify         : %s\n", ok ? "ok" : "ng");
+
+    // 見出しの頂点数が大きすぎるファイルは写像しない(配列の位置の計算が桁あふれしないこと)
+    {
+        csrheader h{ { 'C', 'S', 'R', 'G' }, csrversion, 0, 0, (std::int64_t(1) << 61) - 1, 2 };
+        std::int64_t z = 0;
+        fp = std::fopen("csrconv.csr", "wb"); std::fwrite(&h, sizeof(h), 1, fp); std::fwrite(&z, sizeof(z), 1, fp); std::fclose(fp);
+        std::printf("bad size       : %s\n", H.open("csrconv.csr") ? "ng" : "ok");
+    }
+
+    // weight_tで表せない重みや桁あふれする数は解釈できない行とし、辺のないファイルも扱える
+    auto convert = [&](const char* text) {
+        fp = std::fopen("csrconv.txt", "w"); std::fputs(text, fp); std::fclose(fp);
+        return convertedgelist("csrconv.txt", "csrconv.csr");
+    };
+    ok = !convert("0 1 5000000000\n") && !convert("0 1 -2147483649\n") && !convert("0 99999999999999999999 1\n") &&
+         convert("0 1 2147483647\n") && H.open("csrconv.csr") && H[0][0].w == 2147483647;
+    H.close();
+    ok = ok && convert("# comments only\n") && H.open("csrconv.csr") && H.size() == 0 && stats("csrconv.csr") == 0;
+    H.close();
+    std::printf("edge list      : %s\n", ok ? "ok" : "ng");
+
+    // 壊れたファイルは写像しない
+    savecsr("csrconv.csr", G);
+    fp = std::fopen("csrconv.csr", "r+b"); std::fputc('X', fp); std::fclose(fp);
+    std::printf("bad magic      : %s\n", H.open("csrconv.csr") ? "ng" : "ok");
+    std::remove("csrconv.txt"); std::remove("csrconv.csr");
+    return 0;
+}
@@ -0,0 +1,115 @@
+/**
+ * @brief  全点対最短路問題(all-pairs shortest paths problem)におけるJohnsonのアルゴリズム(Johnson's algorithm)を扱う
+ *
+ * @note   floydwarshallはグラフの疎密によらずΘ(V^3)時間とΘ(V^2)の記憶量を要する
+ *         Johnsonのアルゴリズムは、疎なグラフに対してΟ(VE + V^2lgV)時間で全点対最短路を求める
+ *         さらに、ここでは最短路重み行列の各行を求めた順にコールバックへ渡すので、V×Vの行列全体を記憶しておく必要はない
+ *
+ * @date   2026/10/15
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef __JOHNSON_HPP__
+#define __JOHNSON_HPP__
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "../Graph/graph.hpp"
+#include "../Graph/csr.hpp"
+#include "../PriorityQueue/dheap.hpp"
+#include "../BellmanFord/bellmanford.hpp"
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**
+ * @brief  Johnsonのアルゴリズム
+ *
+ * @note   Johnsonのアルゴリズムは再重み付け(reweighting)によって負辺を取り除き、各頂点からDijkstraのアルゴリズムを実行する
+ *           1. 新しい頂点sと、sから各頂点v ∈ Vへの重み0の辺を加えたグラフG'上でBellman-Fordアルゴリズムを1回実行し、
+ *              h(v) = δ(s, v)を求める. G'が負閉路を含む(すなわちGが負閉路を含む)ならば、そのことを報告して終了する
+ *           2. 各辺(u, v)の重みをw'(u, v) = w(u, v) + h(u) - h(v)に付け替える. 三角不等式h(v) <= h(u) + w(u, v)より
+ *              w'(u, v) >= 0であり、道の重みは端点だけで決まる量h(始点) - h(終点)しか変化しないので、最短路は保存される
+ *           3. 各始点u ∈ Vから再重み付けしたグラフ上でDijkstraのアルゴリズムを実行し、δ(u, v) = δ'(u, v) - h(u) + h(v)を求める
+ *
+ * @note   手順3の各始点の探索は互いに独立なので、OpenMPのスレッドに動的に割り当てる
+ *         各スレッドは推定値の配列(行)と添字付きmin優先度付きキューからなる作業領域を1つだけ確保し、すべての始点で使い回す
+ *         したがって、作業領域の記憶量はスレッドあたりΘ(V)であり、始点ごとのメモリ確保は起こらない
+ *
+ * @note   コールバックf(u, row)は始点uの探索を終えるたびに、それを実行したスレッドから呼び出される
+ *         row[v] = δ(u, v)(vに到達できなければ∞)であり、rowはfから戻った後に次の始点で上書きされる
+ *         fは複数のスレッドから同時に呼び出されうること、始点の順に呼び出されるとは限らないことに注意すること
+ *         (順序や排他が必要ならば、f側で#pragma omp criticalなどを用いる)
+ *
+ * @tparam Graph   グラフの表現(graph_tまたはcsrgraph)
+ * @tparam Visitor void(index_t, const array_t&)として呼び出せる関数オブジェクト
+ * @param  const Graph& G 重み付き有向グラフG(負辺があってもよい)
+ * @param  Visitor      f 最短路重み行列の1行を受け取るコールバック
+ * @return Gが負閉路を含まなければtrue(このときに限り、fがすべての始点について呼び出される)
+ */
+template <class Graph, class Visitor>
+bool johnson(const Graph& G, Visitor f)
+{
+    std::int32_t n = G.size();
+
+    // 1. 新しい頂点nから各頂点への重み0の辺を加えたグラフG'上でh(v) = δ(n, v)を求める
+    edges_t E;
+    for (index_t u = 0; u < n; u++) {
+        for (const auto& e : G[u]) { E.emplace_back(u, e.dst, e.w); }
+    }
+    for (index_t v = 0; v < n; v++) { E.emplace_back(n, v, 0); }
+    auto r = bellmanford(csrgraph(n + 1, E), n, bfmode::worklist);
+    if (!r.first) { return false; }  // 負閉路が存在する
+    array_t h(n);
+    for (index_t v = 0; v < n; v++) { h[v] = r.second[v].d; }
+
+    // 2. w'(u, v) = w(u, v) + h(u) - h(v) >= 0に付け替える(Gの辺は先頭に同じ順序で並んでいる)
+    E.resize(E.size() - n);
+    for (auto& e : E) { e.w += h[e.src] - h[e.dst]; }
+    csrgraph H(n, E);
+    E = edges_t();
+
+    // 3. 各始点からDijkstraのアルゴリズムを実行する
+#pragma omp parallel
+    {
+        array_t row(n, graph::inf);  // スレッドごとの作業領域(推定値v.d)
+        dheap<weight_t> Q(n);        // 各頂点は高々1度しかQに含まれない
+
+#pragma omp for schedule(dynamic, 1)
+        for (index_t s = 0; s < n; s++) {
+            row[s] = 0; Q.insert(s, 0);
+            while (!Q.empty()) {
+                index_t u = Q.extract().first;  // w' >= 0なので、取り出した頂点の推定値はもう減少しない
+                for (const auto& e : H[u]) {
+                    index_t v = e.dst; weight_t d = row[u] + e.w;
+                    if (row[v] > d) { row[v] = d; Q.push(v, d); }
+                }
+            }
+            // δ(s, v) = δ'(s, v) - h(s) + h(v)に戻してから渡し、次の始点のために推定値を∞に戻す
+            for (index_t v = 0; v < n; v++) { if (row[v] != graph::inf) { row[v] += h[v] - h[s]; } }
+            f(s, static_cast<const array_t&>(row));
+            std::fill(row.begin(), row.end(), weight_t(graph::inf));
+        }
+    }
+    return true;
+}
+
+
+
+#endif  // end of __JOHNSON_HPP__
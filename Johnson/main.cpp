@@ -0,0 +1,78 @@
+/**
+ * @brief  Johnsonのアルゴリズムの動作確認
+ * @date   2026/10/15
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include "johnson.hpp"
+#include "../Graph/flatmatrix.hpp"
+#include "../FloydWarshall/floydwarshall.hpp"
+
+
+
+int main(void)
+{
+    using namespace std;
+    using namespace graph;
+
+    // 教科書の図25.6のグラフ(負辺を含むが負閉路は含まない)
+    const std::int32_t k = 5;
+    graph_t G(k);
+    G[0].emplace_back(0, 1, 3);  G[0].emplace_back(0, 2, 8); G[0].emplace_back(0, 4, -4);
+    G[1].emplace_back(1, 3, 1);  G[1].emplace_back(1, 4, 7);
+    G[2].emplace_back(2, 1, 4);
+    G[3].emplace_back(3, 0, 2);  G[3].emplace_back(3, 2, -5);
+    G[4].emplace_back(4, 3, 6);
+    matrix_t D(k, array_t(k));
+    johnson(G, [&D](index_t s, const array_t& row) { D[s] = row; });
+    for (auto& row : D) {
+        for (auto d : row) { cout << d << " "; }
+        cout << endl;
+    }
+
+    // 負閉路を含むグラフでは失敗を報告する
+    G[2].emplace_back(2, 3, 1);  // 2 -> 3 -> 2の重みは1 - 5 < 0
+    cout << "negative cycle: " << (johnson(G, [](index_t, const array_t&) {}) ? "no" : "yes") << endl;
+
+    // 無作為なポテンシャルpを用いてw(u, v) = c(u, v) - p(u) + p(v) (c >= 0)とすれば、負辺を含むが負閉路は含まないグラフが得られる
+    // Floyd-Warshallアルゴリズムの結果と比較する
+    const std::int32_t n = 1000, m = 8 * n;
+    mt19937 mt(1);
+    uniform_int_distribution<index_t>  vdist(0, n - 1);
+    uniform_int_distribution<weight_t> cdist(0, 100), pdist(0, 50);
+    array_t p(n);
+    for (auto& x : p) { x = pdist(mt); }
+    edges_t E;
+    for (std::int32_t i = 0; i < m; i++) {
+        index_t u = vdist(mt), v = vdist(mt);
+        E.emplace_back(u, v, cdist(mt) - p[u] + p[v]);
+    }
+    csrgraph C(n, E);
+
+    auto t0 = chrono::steady_clock::now();
+    flatmatrix<weight_t> F(n, inf);
+    for (index_t v = 0; v < n; v++) { F(v, v) = 0; }
+    for (auto& e : E) { if (e.src != e.dst) { F(e.src, e.dst) = min(F(e.src, e.dst), e.w); } }
+    floydwarshall(F);
+    auto t1 = chrono::steady_clock::now();
+    std::int64_t rows = 0, errors = 0;
+    bool ok = johnson(C, [&](index_t s, const array_t& row) {
+        std::int64_t bad = 0;
+        for (index_t v = 0; v < n; v++) { bad += row[v] != F(s, v); }
+#pragma omp critical
+        { rows++; errors += bad; }
+    });
+    auto t2 = chrono::steady_clock::now();
+    cout << "n = " << n << ", m = " << m << ", ok = " << ok << ", rows = " << rows << ", errors = " << errors << endl;
+    cout << "floydwarshall: " << chrono::duration<double>(t1 - t0).count() << " s, "
+         << "johnson: "       << chrono::duration<double>(t2 - t1).count() << " s" << endl;
+    return 0;
+}
@@ -11,9 +11,14 @@
 // 必要なヘッダファイルのインクルード
 //****************************************
 
-#include "../Graph/graph.hpp"
+#include "kruskal.hpp"
+#include "../Graph/atomic.hpp"
 #include "../DisjointSet/disjointset.hpp"
-#include <iostream>
+#include <cstdint>
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
 
 
 
@@ -61,36 +66,140 @@ std::pair<edges_t, weight_t> kruskal(const graph_t& G)
 }
 
 
-
-int main(void)
+/**
+ * @brief  マルチスレッド版Borůvkaのアルゴリズム
+ */
+std::pair<edges_t, weight_t> boruvka(const graph_t& G)
 {
-    const int n = 9;
-    using namespace std;
-    graph_t G; G.resize(n);
-
-    int adjmtx[n][n] = {
-        // 0,  1,  2,  3,  4,  5,  6,  7,  8
-        { -1,  4, -1, -1, -1, -1, -1,  8, -1, },  // 0
-        {  4, -1,  8, -1, -1, -1, -1, 11, -1, },  // 1
-        { -1,  8, -1,  7, -1,  4, -1, -1,  2, },  // 2
-        { -1, -1,  7, -1,  9, 14, -1, -1, -1, },  // 3
-        { -1, -1, -1,  9, -1, 10, -1, -1, -1, },  // 4
-        { -1, -1,  4, 14, 10, -1,  2, -1, -1, },  // 5
-        { -1, -1, -1, -1, -1,  2, -1,  1,  6, },  // 6
-        {  8, 11, -1, -1, -1, -1,  1, -1,  7, },  // 7
-        { -1, -1,  2, -1, -1, -1,  6,  7, -1, },  // 8
+    using count_t = std::int64_t;
+    const weight_t heaviest = std::numeric_limits<weight_t>::max();
+    const count_t  none     = std::numeric_limits<count_t>::max();
+    std::int32_t n = G.size();
+    edges_t E;  // グラフGから集合G.Eを取り出す(自己ループは最小全域森に含まれない)
+    for (auto& es : G) { for (auto& e : es) { if (e.src != e.dst) { E.push_back(e); } } }
+
+    indices_t comp(n), parent(n), next(n), roots(n);  // 各頂点の成分(成分の根の頂点)と、成分の根の親
+    std::iota(comp.begin(), comp.end(), 0); std::iota(parent.begin(), parent.end(), 0); std::iota(roots.begin(), roots.end(), 0);
+    std::vector<weight_t> lightest(n, heaviest);  // 各成分から出る辺の最小の重み
+    std::vector<count_t>  best(n, none);          // 各成分から出る(重み, 添字)の最小の辺の添字
+    std::vector<count_t> live(E.size()); // 両端点が異なる成分に属する辺の添字
+    std::iota(live.begin(), live.end(), 0);
+    edges_t A; weight_t w = 0;
+
+    // 条件を満たす要素だけを残す(順序は保存しない)
+    auto filter = [](auto& V, auto pred) {
+        using T = typename std::decay<decltype(V)>::type::value_type;
+        std::decay_t<decltype(V)> W(V.size());
+        count_t tail = 0, size = V.size();
+#pragma omp parallel
+        {
+            std::vector<T> local;
+#pragma omp for nowait
+            for (count_t k = 0; k < size; k++) { if (pred(V[k])) { local.push_back(V[k]); } }
+            count_t i = fetch_add(&tail, count_t(local.size()));
+            std::copy(local.begin(), local.end(), W.begin() + i);
+        }
+        W.resize(tail); V.swap(W);
     };
 
-    for (int i = 0; i < n; i++) {
-        for (int j = 0; j < n; j++) {
-            int k = adjmtx[i][j];
-            if (k != -1) G[i].emplace_back(i, j, k);
+
+    while (!live.empty()) {
+        count_t m = live.size(), r = roots.size();
+        // 1. 各成分から出る最小重みの辺を選ぶ. 最小の重みを求めてから、その重みを持つ辺のうち添字が最小のものを求める
+#pragma omp parallel for
+        for (count_t k = 0; k < m; k++) {
+            count_t i = live[k];
+            write_min(&lightest[comp[E[i].src]], E[i].w);
+            write_min(&lightest[comp[E[i].dst]], E[i].w);
+        }
+#pragma omp parallel for
+        for (count_t k = 0; k < m; k++) {
+            count_t i = live[k]; index_t a = comp[E[i].src], b = comp[E[i].dst];
+            if (E[i].w == lightest[a]) { write_min(&best[a], i); }
+            if (E[i].w == lightest[b]) { write_min(&best[b], i); }
         }
+        // 2. 各成分の根を、選んだ辺の反対側の成分の根に付け替え、選んだ辺を森に加える
+        //    2つの成分が同じ辺を選んだ場合は、添字の小さい成分を根として残す
+        weight_t dw = 0;
+#pragma omp parallel reduction(+:dw)
+        {
+            edges_t local;
+#pragma omp for nowait
+            for (count_t k = 0; k < r; k++) {
+                index_t c = roots[k];
+                if (best[c] == none) { continue; }  // 他の成分と辺で結ばれていない
+                const edge& e = E[best[c]];
+                index_t d = (comp[e.src] == c) ? comp[e.dst] : comp[e.src];
+                if (best[d] == best[c] && c < d) { continue; }
+                parent[c] = d; local.push_back(e); dw += e.w;
+            }
+#pragma omp critical
+            A.insert(A.end(), local.begin(), local.end());
+        }
+        w += dw;
+        // 3. ポインタジャンプによって、各成分の根を新しい成分の根に付け替える
+        for (bool changed = true; changed; ) {
+            changed = false;
+#pragma omp parallel for reduction(||:changed)
+            for (count_t k = 0; k < r; k++) {
+                index_t c = roots[k];
+                next[c] = parent[parent[c]]; changed = changed || next[c] != parent[c];
+            }
+#pragma omp parallel for
+            for (count_t k = 0; k < r; k++) { parent[roots[k]] = next[roots[k]]; }
+        }
+#pragma omp parallel for
+        for (index_t v = 0; v < n; v++) { comp[v] = parent[comp[v]]; }
+        // 4. 縮約された成分と、両端点が同じ成分に属する辺を取り除く
+        filter(roots, [&](index_t c) { lightest[c] = heaviest; best[c] = none; return parent[c] == c; });
+        filter(live,  [&](count_t i) { return comp[E[i].src] != comp[E[i].dst]; });
     }
+    return std::make_pair(A, w);
+}
 
-    auto mst = kruskal(G);
-    cout << mst.second << endl;
-    
-    return 0;
+
+/**
+ * @brief  Filter-Kruskalのアルゴリズムの本体
+ * @note   辺の範囲[first, last)を処理する. 軽い側を再帰的に処理し、重い側はループで処理する
+ */
+static void filterkruskal(edges_t::iterator first, edges_t::iterator last,
+                          disjointset& ds, edges_t& A, weight_t& w, std::mt19937& mt)
+{
+    const std::ptrdiff_t threshold = 1024;  // これ以下の辺はソートして処理する
+    while (last - first > threshold) {
+        weight_t p = first[std::uniform_int_distribution<std::ptrdiff_t>(0, last - first - 1)(mt)].w;
+        auto mid = std::partition(first, last, [p](const edge& e) { return e.w <= p; });
+        if (mid == last) { mid = std::partition(first, last, [p](const edge& e) { return e.w < p; }); }
+        if (mid == first) { break; }  // すべての辺の重みが等しい
+
+        filterkruskal(first, mid, ds, A, w, mt);  // 1. 軽い辺を処理し、
+        // 2. 重い辺のうち、両端点が異なる木に属するものだけを残す
+        last  = std::partition(mid, last, [&ds](const edge& e) { return ds.findset(e.src) != ds.findset(e.dst); });
+        first = mid;
+    }
+    std::sort(first, last);
+    for (auto it = first; it != last; ++it) {
+        if (ds.findset(it->src) != ds.findset(it->dst)) {
+            A.push_back(*it); w += it->w;
+            ds.merge(it->src, it->dst);
+        }
+    }
 }
 
+
+/**
+ * @brief  Filter-Kruskalのアルゴリズム
+ */
+std::pair<edges_t, weight_t> filterkruskal(const graph_t& G)
+{
+    std::int32_t n = G.size();
+    disjointset ds(static_cast<std::size_t>(n));
+    edges_t E;
+    for (auto& es : G) { for (auto& e : es) { if (e.src != e.dst) { E.push_back(e); } } }
+    for (index_t v = 0; v < n; v++) { ds.makeset(v); }
+
+    weight_t w = 0; edges_t A;
+    std::mt19937 mt(0);
+    filterkruskal(E.begin(), E.end(), ds, A, w, mt);
+    return std::make_pair(A, w);
+}
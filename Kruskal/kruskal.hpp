@@ -46,6 +46,41 @@
 std::pair<edges_t, weight_t> kruskal(const graph_t& G);
 
 
+/**
+ * @brief  マルチスレッド版Borůvkaのアルゴリズム
+ *
+ * @note   Borůvkaのアルゴリズムは、各連結成分から出る最小重みの辺を(すべての成分について同時に)選んで森に加え、
+ *         選んだ辺で結ばれた成分を1つに縮約する段階を、成分間の辺がなくなるまで繰り返す
+ *         各段階で成分の数は少なくとも半分になるので、段階の数は高々lgVであり、各段階はΟ(E)の仕事でマルチスレッド化できる
+ *
+ * @note   最小重みの辺の選択は、(重み, 添字)の辞書式順序で行う. まず両端の成分の最小の重みと不可分にminを取り、
+ *         次にその重みを持つ辺の64ビットの添字と不可分にminを取る(添字を重みと1語に詰め込まないので、辺の数は2^32以上でもよい)
+ *         添字で同じ重みの辺を区別するので辺は全順序付けられ、選んだ辺が閉路を作ることはない
+ *         (2つの成分が互いに同じ辺を選んだ場合だけは、添字の小さい成分を根として残す)
+ *         縮約はポインタジャンプで成分の根を求めて行い、両端が同じ成分に属するようになった辺は取り除く
+ *
+ * @param  const graph& G グラフG
+ * @return 辺集合Aとその重み(最小全域森の重み)
+ */
+std::pair<edges_t, weight_t> boruvka(const graph_t& G);
+
+
+/**
+ * @brief  Filter-Kruskalのアルゴリズム
+ *
+ * @note   Kruskalのアルゴリズムはすべての辺をソートするが、重い辺の多くは、それより軽い辺で両端がすでに連結された時点で不要になる
+ *         Filter-Kruskalでは、クイックソートと同じく辺集合を枢軸(pivot)の重み以下の辺と、それより重い辺に分割し、
+ *           1. 軽い辺を再帰的に処理し、
+ *           2. 重い辺のうち、両端点が同じ木に属する辺を取り除いて(filter)から、残りを再帰的に処理する
+ *         辺の数が十分小さくなれば、ソートしてKruskalのアルゴリズムを行う. ソートされる辺は最終的に残ったものだけなので、
+ *         密なグラフではΟ(E + VlgVlg(E/V))程度の時間で済む
+ *
+ * @param  const graph& G グラフG
+ * @return 辺集合Aとその重み(最小全域森の重み)
+ */
+std::pair<edges_t, weight_t> filterkruskal(const graph_t& G);
+
+
 
 #endif  // end of __KRUSKAL_HPP__
 
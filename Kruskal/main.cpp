@@ -0,0 +1,68 @@
+/**
+ * @brief Kruskalのアルゴリズム、Borůvkaのアルゴリズム、Filter-Kruskalのアルゴリズムのテストを行う
+ * @date  作成日     : 2016/02/16
+ * @date  最終更新日 : 2026/10/15
+ */
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <iostream>
+#include <random>
+#include "kruskal.hpp"
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+int main(void)
+{
+    const int n = 9;
+    using namespace std;
+    graph_t G; G.resize(n);
+
+    int adjmtx[n][n] = {
+        // 0,  1,  2,  3,  4,  5,  6,  7,  8
+        { -1,  4, -1, -1, -1, -1, -1,  8, -1, },  // 0
+        {  4, -1,  8, -1, -1, -1, -1, 11, -1, },  // 1
+        { -1,  8, -1,  7, -1,  4, -1, -1,  2, },  // 2
+        { -1, -1,  7, -1,  9, 14, -1, -1, -1, },  // 3
+        { -1, -1, -1,  9, -1, 10, -1, -1, -1, },  // 4
+        { -1, -1,  4, 14, 10, -1,  2, -1, -1, },  // 5
+        { -1, -1, -1, -1, -1,  2, -1,  1,  6, },  // 6
+        {  8, 11, -1, -1, -1, -1,  1, -1,  7, },  // 7
+        { -1, -1,  2, -1, -1, -1,  6,  7, -1, },  // 8
+    };
+
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            int k = adjmtx[i][j];
+            if (k != -1) G[i].emplace_back(i, j, k);
+        }
+    }
+
+    auto mst = kruskal(G);
+    cout << mst.second << endl;
+    cout << boruvka(G).second << " " << filterkruskal(G).second << endl;
+
+    // 連結でないランダムなグラフ上で3つのアルゴリズムを比較する
+    const int vs = 1 << 17, es = 1 << 20;
+    mt19937 mt(1);
+    uniform_int_distribution<index_t>  vdist(0, vs - 1);
+    uniform_int_distribution<weight_t> wdist(-1000, 1000);
+    graph_t R(vs);
+    for (int i = 0; i < es; i++) {
+        index_t u = vdist(mt), v = vdist(mt); weight_t w = wdist(mt);
+        R[u].emplace_back(u, v, w); R[v].emplace_back(v, u, w);
+    }
+    auto a = kruskal(R), b = boruvka(R), c = filterkruskal(R);
+    bool ok = a.second == b.second && a.second == c.second && a.first.size() == b.first.size() && a.first.size() == c.first.size();
+    cout << a.first.size() << " edges, weight " << a.second << " " << (ok ? "ok" : "ng") << endl;
+    
+    return 0;
+}
+
@@ -0,0 +1,81 @@
+/**
+ * @brief  2点間最短路の問い合わせ構造体の動作確認
+ * @date   2026/10/15
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include "p2p.hpp"
+#include "../Dijkstra/dijkstra.hpp"
+#include "../Graph/csr.hpp"
+
+
+
+int main(void)
+{
+    using namespace std;
+
+    // k×kの格子グラフ(重みは対称なのでG^T = G). 辺重みは1以上なので、マンハッタン距離はconsistentなヒューリスティックである
+    const int k = 300, n = k * k, queries = 200;
+    mt19937 mt(1);
+    uniform_int_distribution<weight_t> wdist(1, 10);
+    uniform_int_distribution<index_t>  vdist(0, n - 1);
+    edges_t E;
+    for (index_t i = 0; i < k; i++) {
+        for (index_t j = 0; j < k; j++) {
+            index_t u = i * k + j;
+            if (j + 1 < k) { weight_t w = wdist(mt); E.emplace_back(u, u + 1, w); E.emplace_back(u + 1, u, w); }
+            if (i + 1 < k) { weight_t w = wdist(mt); E.emplace_back(u, u + k, w); E.emplace_back(u + k, u, w); }
+        }
+    }
+    csrgraph G(n, E);
+    p2pquery<csrgraph> Q(G);
+
+    // 求めた道が実際にsからtへの重みdの道であるか確かめる
+    auto check = [&](index_t s, index_t t, weight_t d) -> bool {
+        indices_t p = Q.path();
+        if (p.empty() || p.front() != s || p.back() != t) { return false; }
+        weight_t w = 0;
+        for (size_t i = 0; i + 1 < p.size(); i++) {
+            weight_t c = graph::inf;
+            for (const auto& e : G[p[i]]) { if (e.dst == p[i + 1]) { c = min(c, e.w); } }
+            w += c;
+        }
+        return w == d;
+    };
+
+    bool ok = true;
+    int64_t settled[3] = { 0, 0, 0 };
+    for (int q = 0; q < queries; q++) {
+        index_t s = vdist(mt), t = vdist(mt);
+        auto manhattan = [&](index_t v) -> weight_t { return abs(v / k - t / k) + abs(v % k - t % k); };
+        weight_t expected = dijkstra(G, s)[t].d;
+
+        weight_t d0 = Q.dijkstra(s, t);          ok = ok && d0 == expected && check(s, t, d0); settled[0] += Q.settled;
+        weight_t d1 = Q.bidirectional(s, t);     ok = ok && d1 == expected && check(s, t, d1); settled[1] += Q.settled;
+        weight_t d2 = Q.astar(s, t, manhattan);  ok = ok && d2 == expected && check(s, t, d2); settled[2] += Q.settled;
+    }
+    cout << "average settled vertices per query (|V| = " << n << ")" << endl;
+    cout << "  dijkstra      : " << settled[0] / queries << endl;
+    cout << "  bidirectional : " << settled[1] / queries << endl;
+    cout << "  astar         : " << settled[2] / queries << endl;
+
+    // 到達できない終点
+    graph_t H(3);
+    H[0].emplace_back(0, 1, 5);
+    graph_t HT(3);
+    HT[1].emplace_back(1, 0, 5);
+    p2pquery<graph_t> R(H, HT);
+    ok = ok && R.dijkstra(0, 2) == graph::inf && R.bidirectional(0, 2) == graph::inf && R.path().empty();
+    ok = ok && R.bidirectional(0, 1) == 5 && R.path() == indices_t({ 0, 1 });
+
+    cout << (ok ? "ok" : "ng") << endl;
+    return 0;
+}
@@ -0,0 +1,231 @@
+/**
+ * @brief  2点間最短路問題(point-to-point shortest path problem)に繰り返し答える問い合わせ構造体
+ *
+ * @note   dijkstra(G, s)は呼び出しごとにΘ(V)のvertices_tを確保・初期化し、グラフ全体を探索する
+ *         始点sから終点tへの距離だけが必要な場合、tを確定した時点で探索を打ち切ってよい. さらに、
+ *         同じグラフに何度も問い合わせるならば、作業領域は問い合わせの間で使い回したい
+ *
+ *         そこで、各頂点の推定値v.dと先行点v.πに版(version)を付ける. 問い合わせごとに版を1つ進め、
+ *         版が現在の版と異なる頂点はv.d = ∞, v.π = NILであるとみなす. これによって、初期化の手間は
+ *         探索で実際に触れた頂点の数に比例するだけになる(Θ(V)の初期化は版が一巡したときだけ行う)
+ *
+ * @date   2026/10/15
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef __P2P_HPP__
+#define __P2P_HPP__
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <cstdint>
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include "../Graph/graph.hpp"
+#include "../PriorityQueue/dheap.hpp"
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief  どの頂点に対しても0を返すヒューリスティック(A*探索はDijkstraのアルゴリズムに一致する)
+ */
+struct zeroheuristic {
+    weight_t operator()(index_t) const { return 0; }
+};
+
+
+/**
+ * @brief  2点間最短路の問い合わせ構造体
+ *
+ * @note   次の3種類の探索を提供する. いずれも距離δ(s, t)を返し、直後にpath()で最短路を取り出せる
+ *           dijkstra(s, t)      : 終点tを確定した時点で打ち切る単方向のDijkstraのアルゴリズム
+ *           bidirectional(s, t) : sからGを、tからG^Tを交互に探索する双方向のDijkstraのアルゴリズム
+ *           astar(s, t, h)      : 推定値v.d + h(v)をキーとするA*探索
+ *
+ * @note   A*探索のヒューリスティックhは、h(t) = 0かつ各辺(u, v)についてh(u) <= w(u, v) + h(v)を満たす(consistent)と仮定する
+ *         このとき、キーの順に取り出される頂点の推定値は確定しており、各頂点を2度取り出す必要はない
+ *
+ * @note   キューには添字付きd分ヒープ(dheap)を用い、推定値の減少はDECREASE-KEYで行う. 古い項目が生じないので、
+ *         問い合わせ構造体の記憶量は辺の数によらずΘ(V)である(スレッドごとに構造体を持っても辺の数に比例する領域は要らない)
+ *
+ * @tparam Graph グラフの表現(graph_tまたはcsrgraph)
+ */
+template <class Graph>
+struct p2pquery {
+    using stamp_t = std::uint32_t;
+
+    /**< @brief 一方向の探索の作業領域 */
+    struct workspace {
+        array_t              d;     /**< 推定値 */
+        indices_t            pi;    /**< 先行点 */
+        std::vector<stamp_t> seen;  /**< seen[v] == versionならば、d[v]とpi[v]は今回の問い合わせで書かれている */
+        std::vector<stamp_t> done;  /**< done[v] == versionならば、vは今回の問い合わせで確定している */
+        dheap<weight_t>      Q;     /**< 最短路推定値をキーとするmin優先度付きキュー */
+
+        explicit workspace(std::size_t n) : d(n), pi(n), seen(n, 0), done(n, 0), Q(n) {}
+    };
+
+    const Graph& G;         /**< グラフG */
+    const Graph& GT;        /**< 転置グラフG^T(双方向探索でのみ用いる) */
+    stamp_t      version;   /**< 現在の問い合わせの版 */
+    workspace    F, B;      /**< 前向き(Gでsから)と後ろ向き(G^Tでtから)の作業領域 */
+    index_t      s, t;      /**< 直前の問い合わせの始点と終点 */
+    index_t      meet;      /**< 直前の問い合わせで見つけた最短路上の頂点(前向きと後ろ向きの探索が出会った頂点) */
+    std::int64_t settled;   /**< 直前の問い合わせで確定した頂点の数 */
+
+    /**
+     * @param const Graph& G  非負の重み付き有向グラフG
+     * @param const Graph& GT Gの転置グラフG^T
+     */
+    p2pquery(const Graph& G, const Graph& GT)
+        : G(G), GT(GT), version(0), F(G.size()), B(GT.size()),
+          s(graph::nil), t(graph::nil), meet(graph::nil), settled(0) {}
+
+    /**
+     * @note 無向グラフ(隣接リストが対称なグラフ)ではG^T = Gである
+     */
+    explicit p2pquery(const Graph& G) : p2pquery(G, G) {}
+
+    /**
+     * @brief  sからtへの最短路重みを、tを確定した時点で打ち切るDijkstraのアルゴリズムで求める
+     */
+    weight_t dijkstra(index_t s, index_t t)
+    {
+        return astar(s, t, zeroheuristic());
+    }
+
+    /**
+     * @brief  sからtへの最短路重みをA*探索で求める
+     * @note   キーをv.d + h(v)とする以外はDijkstraのアルゴリズムと同じである. hがtへの距離をよく近似するほど、
+     *         tから遠ざかる方向の頂点が取り出されにくくなり、確定する頂点の数が減る
+     * @param  Heuristic h 各頂点vからtへの距離の下界h(v)
+     */
+    template <class Heuristic>
+    weight_t astar(index_t s, index_t t, Heuristic h)
+    {
+        start(s, t);
+        workspace& W = F;
+        W.Q.push(s, h(s));
+        while (!W.Q.empty()) {
+            index_t u = W.Q.extract().first;
+            W.done[u] = version; settled++;
+            if (u == t) { meet = t; return W.d[t]; }
+            for (const auto& e : G[u]) {
+                index_t v = e.dst;
+                if (W.done[v] != version && dist(W, v) > W.d[u] + e.w) {
+                    set(W, v, W.d[u] + e.w, u);
+                    W.Q.push(v, W.d[v] + h(v));  // vがQに含まれていれば、そのキーを減少させる
+                }
+            }
+        }
+        return graph::inf;
+    }
+
+    /**
+     * @brief  sからtへの最短路重みを双方向のDijkstraのアルゴリズムで求める
+     *
+     * @note   前向きの探索と後ろ向きの探索のうち、キューの最小キーが小さいほうを1歩進める
+     *         辺(u, v)を調べたとき、vが反対側の探索でも到達済みならば、vを経由する道s ~> v ~> tの重みで
+     *         これまでに見つけた最良の重みμを更新する. 両方の最小キーの和がμ以上になれば、μより短い道は存在しない
+     *         両側の探索はそれぞれおよそ半径δ(s, t) / 2の球しか探索しないので、単方向よりも確定する頂点が少ない
+     */
+    weight_t bidirectional(index_t s, index_t t)
+    {
+        start(s, t);
+        set(B, t, 0, graph::nil);
+        F.Q.push(s, 0);
+        B.Q.push(t, 0);
+        weight_t mu = (s == t) ? 0 : weight_t(graph::inf);
+        meet = (s == t) ? s : index_t(graph::nil);
+
+        // 作業領域Wの最小の頂点を確定し、その辺を緩和する. Oは反対側の作業領域である
+        auto step = [&](const Graph& H, workspace& W, workspace& O) -> void {
+            index_t u = W.Q.extract().first;
+            W.done[u] = version; settled++;
+            for (const auto& e : H[u]) {
+                index_t  v = e.dst;
+                weight_t d = W.d[u] + e.w;
+                if (W.done[v] != version && dist(W, v) > d) {
+                    set(W, v, d, u);
+                    W.Q.push(v, d);
+                }
+                weight_t dv = dist(O, v);
+                if (dv != graph::inf && W.d[v] + dv < mu) { mu = W.d[v] + dv; meet = v; }
+            }
+        };
+
+
+        while (!F.Q.empty() && !B.Q.empty()) {
+            weight_t kf = F.Q.top().second, kb = B.Q.top().second;
+            if (kf + kb >= mu) { break; }  // 残りのどの道もμより短くはならない
+            if (kf <= kb) { step(G,  F, B); }
+            else          { step(GT, B, F); }
+        }
+        return mu;
+    }
+
+    /**
+     * @brief  直前の問い合わせで求めたsからtへの最短路上の頂点を順に返す(道がなければ空)
+     */
+    indices_t path() const
+    {
+        indices_t p;
+        if (meet == graph::nil) { return p; }
+        for (index_t v = meet; v != graph::nil; v = pred(F, v)) { p.push_back(v); }   // meet ~> sを逆順に辿り、
+        std::reverse(p.begin(), p.end());
+        for (index_t v = pred(B, meet); v != graph::nil; v = pred(B, v)) { p.push_back(v); }  // meet ~> tを辿る
+        return p;
+    }
+
+private:
+    /**< @brief 版を1つ進めて作業領域を空にし、始点sの推定値を0とする */
+    void start(index_t s, index_t t)
+    {
+        if (++version == 0) {  // 版が一巡したときだけ印を消す
+            for (workspace* W : { &F, &B }) {
+                std::fill(W->seen.begin(), W->seen.end(), 0);
+                std::fill(W->done.begin(), W->done.end(), 0);
+            }
+            version = 1;
+        }
+        F.Q.clear(); B.Q.clear();
+        this->s = s; this->t = t; meet = graph::nil; settled = 0;
+        set(F, s, 0, graph::nil);
+    }
+
+    /**< @brief 今回の問い合わせにおける推定値v.dを返す(まだ触れていなければ∞) */
+    weight_t dist(const workspace& W, index_t v) const
+    {
+        return W.seen[v] == version ? W.d[v] : weight_t(graph::inf);
+    }
+
+    /**< @brief 今回の問い合わせにおける先行点v.πを返す(まだ触れていなければNIL) */
+    index_t pred(const workspace& W, index_t v) const
+    {
+        return W.seen[v] == version ? W.pi[v] : index_t(graph::nil);
+    }
+
+    /**< @brief v.d = d, v.π = piとし、vに今回の版の印を付ける */
+    void set(workspace& W, index_t v, weight_t d, index_t pi)
+    {
+        W.d[v] = d; W.pi[v] = pi; W.seen[v] = version;
+    }
+};
+
+
+
+#endif  // end of __P2P_HPP__
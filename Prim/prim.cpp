@@ -13,7 +13,7 @@
 
 #include <iostream>
 #include "prim.hpp"
-#include "../PriorityQueue/pqueue.hpp"
+#include "../Graph/csr.hpp"
 
 
 
@@ -23,54 +23,6 @@
 
 
 
-/**
- * @brief  Primのアルゴリズム
- *
- * @note   Primのアルゴリズムは、グラフの最短路を求めるDijkstraのアルゴリズムとほとんど同じように動作する
- *         Primのアルゴリズムは集合Aの辺が常に1つの木を形成するという性質を持つ. この木は任意の根rから開始し、Vの頂点全体を張るまで成長する
- *         各ステップでは、Aの頂点とある孤立点(Aの辺と接続していない頂点)を連結する軽い辺を木Aに加える
- *         Aに対して安全な辺だけがこの規則によってAに加えられるから、アルゴリズムが終了したとき、Aの辺は最小全域木を形成する
- *         各ステップでは木の重みの増加を限りなく小さく抑える辺を用いて木を成長させるので、これは貪欲戦略である
- *
- * @note   優先度付きキューの優先度更新を行わないため、優先度付きキューが空になるまでに行われる挿入の回数はΟ(E)であるが、
- *         EXTRACT-MIN呼び出し時に、黒頂点であれば無視をすることで、全体としての実行時間をΟ(ElgV)としている
- * 
- * @param  const graph_t& G グラフG
- * @param  index_t        r 最小全域木の根
- */
-std::pair<edges_t, weight_t> prim(const graph_t& G, index_t r)
-{
-    std::int32_t n = G.size();
-    std::size_t m = 0;
-    for (auto& es : G) { m += es.size(); }
-    //struct cmp { bool operator()(const edge& e, const edge& f) { return e.w > f.w; } };
-    std::vector<std::int32_t> visited(n);
-    edges_t A; weight_t w;
-
-    
-    for (index_t u = 0; u < n; u++) {
-        visited[u] = false;  // 各頂点を白色に初期化
-    }
-    pqueue<edge> Q(m);
-    Q.insert(edge(graph::nil, r, w = 0));  // 根rはキーを0に設定する
-    while (!Q.empty()) {
-        edge e = Q.extract();              // 軽い辺を取り出す
-        index_t u = e.dst;
-        if (visited[u]) { continue; }      // 取り出した辺が安全な辺ではない場合、再びループに戻り条件判定を行う
-        
-        for (auto&& f : G[u]) {            // uと隣接し、木に属さない各頂点vの更新を行う
-            if (!visited[f.dst/*頂点v*/]) { Q.insert(f); }
-        }
-        visited[u] = true;                 // 頂点uを黒色に彩色し、
-        w += e.w;                          // 最小重みを更新する
-        if (e.src != graph::nil) {  // アルゴリズムが終了したとき、min優先度付きキューは空であり、
-            A.emplace_back(e);      // Gに対する最小全域木AはA = { (v, v.π) : v ∈ V - { r } }である  
-        }
-    }
-    return std::make_pair(A, w);
-}
-
-
 /**
  * @brief  Primのアルゴリズム
  *
@@ -166,6 +118,15 @@ int main(void)
 
     auto mst = prim(M);
     cout << mst.second << endl;
+
+    // 隣接リスト表現とCSR表現でも同じ重みの最小全域木が得られる
+    graph_t G(n);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            if (adjmtx[i][j] != -1) { G[i].emplace_back(i, j, adjmtx[i][j]); }
+        }
+    }
+    cout << prim(G).second << " " << prim(csrgraph(G)).second << endl;
     
     return 0;
 }
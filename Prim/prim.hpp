@@ -20,12 +20,15 @@
 // 必要なヘッダファイルのインクルード
 //****************************************
 
+#include <utility>
 #include "../Graph/graph.hpp"
+#include "../Graph/visitor.hpp"
+#include "../PriorityQueue/dheap.hpp"
 
 
 
 //****************************************
-// 関数プロトタイプ
+// 関数の宣言および定義
 //****************************************
 
 /**
@@ -37,13 +40,75 @@
  *         Aに対して安全な辺だけがこの規則によってAに加えられるから、アルゴリズムが終了したとき、Aの辺は最小全域木を形成する
  *         各ステップでは木の重みの増加を限りなく小さく抑える辺を用いて木を成長させるので、これは貪欲戦略である
  *
- * @note   優先度付きキューの優先度更新を行わないため、優先度付きキューが空になるまで行われる挿入の回数はΟ(E)であるが、
- *         EXTRACT-MIN呼び出し時に、黒頂点であれば無視をすることで、全体としての実行時間をΟ(ElgV)としている
- * 
- * @param  const graph_t& G グラフG
+ * @note   木に属さない頂点をkey属性に基づく添字付き4分ヒープQに置き、第11行の暗黙のDECREASE-KEYをそのまま行う
+ *         Qが含む要素は高々|V|個であり、EXTRACT-MINは|V|回、DECREASE-KEYは高々|E|回なので、全体の実行時間はΟ(ElgV)である
+ *
+ * @note   各事象で訪問者visの同名のメンバ関数を呼び出す(Graph/visitor.hpp). 辺の緩和はvのキーの更新にあたる
+ *
+ * @tparam Graph   グラフの表現(graph_tまたはcsrgraph)
+ * @tparam Visitor 訪問者の型(nullvisitorを継承したもの)
+ * @param  const Graph&   G   グラフG
+ * @param  index_t        r   最小全域木の根
+ * @param  Visitor&&      vis 訪問者
+ */
+template <class Graph, class Visitor>
+std::pair<edges_t, weight_t> prim(const Graph& G, index_t r, Visitor&& vis)
+{
+    std::int32_t n = G.size();
+    std::vector<std::int32_t> visited(n);
+    array_t   key(n);
+    indices_t pi(n);
+    edges_t A; weight_t w = 0;
+
+
+    for (index_t u = 0; u < n; u++) {
+        key[u] = graph::inf;  // 各頂点のキーを∞に設定し、
+        pi[u]  = graph::nil;  // 各頂点の親をNILに設定する
+        visited[u] = false;   // 各頂点を白色に初期化
+        vis.initialize_vertex(u);
+    }
+    dheap<weight_t> Q(n);
+    key[r] = 0; Q.insert(r, key[r]);           // 根rはキーを0に設定する
+    vis.discover_vertex(r);
+    while (!Q.empty()) {
+        index_t u = Q.extract().first;         // 軽い辺に接続する頂点uを取り出す
+        vis.examine_vertex(u);
+        for (const auto& e : G[u]) {           // uと隣接し、木に属さない各頂点vの更新を行う
+            index_t v = e.dst;
+            vis.examine_edge(e);
+            if (!visited[v] && v != u && e.w < key[v]) {
+                if (!Q.contains(v)) { vis.discover_vertex(v); }
+                key[v] = e.w; pi[v] = u;       // vのπ属性とkey属性を更新し、
+                Q.push(v, key[v]);             // vがQに含まれていればDECREASE-KEYを、含まれていなければINSERTを行う
+                vis.edge_relaxed(e);
+            }
+            else {
+                vis.edge_not_relaxed(e);
+            }
+        }
+        visited[u] = true;                     // 頂点uを黒色に彩色し、
+        w += key[u];                           // 最小重みを更新する
+        if (pi[u] != graph::nil) {  // アルゴリズムが終了したとき、min優先度付きキューは空であり、
+            A.emplace_back(pi[u], u, key[u]);  // Gに対する最小全域木AはA = { (v, v.π) : v ∈ V - { r } }である
+        }
+        vis.finish_vertex(u);
+    }
+    return std::make_pair(A, w);
+}
+
+
+/**
+ * @brief  Primのアルゴリズム(事象を受け取らない)
+ *
+ * @tparam Graph グラフの表現(graph_tまたはcsrgraph)
+ * @param  const Graph&   G グラフG
  * @param  index_t        r 最小全域木の根
  */
-std::pair<edges_t, weight_t> prim(const graph_t& G, index_t r = 0);
+template <class Graph>
+std::pair<edges_t, weight_t> prim(const Graph& G, index_t r = 0)
+{
+    return prim(G, r, nullvisitor());
+}
 
 
 
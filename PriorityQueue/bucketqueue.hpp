@@ -0,0 +1,130 @@
+/**
+ * @brief バケツキュー(Dialのアルゴリズムで用いる優先度付きキュー)の実装
+ * @date  2026/10/15
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef __BUCKETQUEUE_HPP__
+#define __BUCKETQUEUE_HPP__
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <cassert>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief  バケツキュー
+ *
+ * @note   要素は0,1,...,n-1の整数であり、それぞれ非負整数のキーを持つ. 単調なmin優先度付きキューであり、
+ *         キューに含まれるキーは常に区間[cursor, cursor + C]に収まると仮定する(cursorは最後に取り出したキー)
+ *         辺重みの最大値がCのとき、Dijkstraのアルゴリズムはこの条件を満たす(Dialのアルゴリズム)
+ *
+ * @note   C + 1個のバケツを循環的に用い、キーkの要素をバケツk mod (C + 1)に置く. 上の仮定から
+ *         1つのバケツに異なるキーの要素が同時に入ることはない. 各バケツは要素の添字による双方向連結リストであり、
+ *         要素ごとにリスト上の位置を持つので、キーの更新(decrease-key)はΟ(1)時間で行える
+ *         extractはcursorを空でないバケツまで進めるので、Dijkstraのアルゴリズム全体ではΟ(E + VC)時間である
+ *         記憶量はΘ(n + C)であり、挿入の回数には依存しない. Cが大きい(例えば辺重みが2^31 - 1に達する)場合は、
+ *         バケツの配列が巨大になるので、基数ヒープ(radixheap)を用いること
+ */
+struct bucketqueue {
+    using index_t = std::int32_t;
+    using key_t   = std::int32_t;
+    using pair_t  = std::pair<index_t, key_t>;
+    enum { nil = -1 };
+
+    std::vector<index_t> head;        /**< 各バケツのリストの先頭 */
+    std::vector<index_t> next, prev;  /**< 要素の後続と先行 */
+    std::vector<key_t>   key;         /**< 要素のキー(キューに含まれない要素はnil) */
+    std::size_t size;                 /**< 格納されている要素数 */
+    key_t cursor;                     /**< 最後に取り出したキー */
+
+    /**
+     * @param std::size_t n 要素数(要素は0,1,...,n-1)
+     * @param key_t       C キューに同時に含まれるキーの幅の最大値(辺重みの最大値. 非負)
+     * @note  バケツの数C + 1はkey_tでは桁あふれしうるので、std::size_tで計算する
+     */
+    bucketqueue(std::size_t n, key_t C)
+        : head(buckets(C), nil), next(n, nil), prev(n, nil), key(n, nil), size(0), cursor(0) {}
+
+    /**< @brief 要素vがキューに含まれるか判定する */
+    bool contains(index_t v) const
+    {
+        return key[v] != nil;
+    }
+
+    /**
+     * @brief 要素vをキーkで挿入する. vがすでに含まれていればそのキーをkに変更する
+     * @note  実行時間はΟ(1)
+     */
+    void insert(index_t v, key_t k)
+    {
+        assert(k >= cursor && static_cast<std::size_t>(k - cursor) < head.size());
+        if (contains(v)) { erase(v); }
+        index_t& h = head[k % head.size()];
+        next[v] = h; prev[v] = nil;
+        if (h != nil) { prev[h] = v; }
+        h = v; key[v] = k;
+        size = size + 1;
+    }
+
+    /**
+     * @brief 要素vをキューから削除する
+     * @note  実行時間はΟ(1)
+     */
+    void erase(index_t v)
+    {
+        assert(contains(v));
+        if (prev[v] != nil) { next[prev[v]] = next[v]; }
+        else                { head[key[v] % head.size()] = next[v]; }
+        if (next[v] != nil) { prev[next[v]] = prev[v]; }
+        key[v] = nil;
+        size = size - 1;
+    }
+
+    /**
+     * @brief 最小のキーを持つ要素を削除し、その(要素, キー)の対を返す
+     */
+    pair_t extract()
+    {
+        assert(size > 0);  // アンダーフローチェック
+        while (head[cursor % head.size()] == nil) { cursor++; }  // 空でないバケツまで進める
+        index_t v = head[cursor % head.size()];
+        erase(v);
+        return std::make_pair(v, cursor);
+    }
+
+    /**< @brief キューが空かどうかを返す */
+    bool empty() const
+    {
+        return size == 0;
+    }
+
+private:
+    /**< @brief キーの幅の最大値がCのときのバケツの数C + 1を返す */
+    static std::size_t buckets(key_t C)
+    {
+        assert(C >= 0);
+        return static_cast<std::size_t>(C) + 1;
+    }
+};
+
+
+
+#endif  // end of __BUCKETQUEUE_HPP__
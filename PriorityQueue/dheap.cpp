@@ -0,0 +1,77 @@
+/**
+ * @brief 添字付きd分ヒープのテストプログラム
+ * @date  2026/10/15
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <iostream>
+#include <random>
+#include <set>
+#include "dheap.hpp"
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**
+ * @brief 挿入、キーの減少、最小要素の取り出しを無作為に行い、(キー, 要素)の対の集合と比較する
+ */
+template <std::size_t D>
+bool check(std::int32_t n, std::int32_t ops, std::mt19937& mt)
+{
+    dheap<std::int32_t, D> H(n);
+    std::set<std::pair<std::int32_t, std::int32_t>> S;
+    std::vector<std::int32_t> key(n);
+    std::uniform_int_distribution<std::int32_t> item(0, n - 1), value(0, 1000000), op(0, 2);
+    for (std::int32_t i = 0; i < ops; i++) {
+        std::int32_t x = item(mt);
+        switch (op(mt)) {
+        case 0:  // 挿入またはキーの減少
+            if (!H.contains(x)) { key[x] = value(mt); H.insert(x, key[x]); S.emplace(key[x], x); }
+            else if (key[x] > 0) {
+                S.erase(std::make_pair(key[x], x));
+                key[x] = std::uniform_int_distribution<std::int32_t>(0, key[x] - 1)(mt);
+                H.decrease_key(x, key[x]); S.emplace(key[x], x);
+            }
+            break;
+        case 1:  // 最小要素の取り出し
+            if (!S.empty()) {
+                auto p = H.extract();
+                if (p.second != S.begin()->first || key[p.first] != p.second) { return false; }
+                S.erase(std::make_pair(p.second, p.first));
+            }
+            break;
+        default:  // 所属判定
+            if (H.contains(x) != (S.count(std::make_pair(key[x], x)) > 0)) { return false; }
+            break;
+        }
+        if (H.size() != S.size()) { return false; }
+    }
+    H.clear();
+    for (std::int32_t x = 0; x < n; x++) { if (H.contains(x)) { return false; } }
+    return true;
+}
+
+
+
+int main(void)
+{
+    std::mt19937 mt(1);
+    std::cout << "d = 2: " << (check<2>(1000, 200000, mt) ? "ok" : "ng") << std::endl;
+    std::cout << "d = 4: " << (check<4>(1000, 200000, mt) ? "ok" : "ng") << std::endl;
+    std::cout << "d = 8: " << (check<8>(1000, 200000, mt) ? "ok" : "ng") << std::endl;
+
+    dheap<int> H(8);
+    H.insert(3, 15); H.insert(5, 4); H.insert(1, 45); H.insert(7, 5);
+    H.decrease_key(1, 1);
+    while (!H.empty()) { auto p = H.extract(); std::cout << p.first << ":" << p.second << " "; }
+    std::cout << std::endl;
+    return 0;
+}
@@ -0,0 +1,184 @@
+/**
+ * @brief 添字付きd分ヒープ(indexed d-ary heap)の実装
+ * @date  2026/10/15
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef __DHEAP_HPP__
+#define __DHEAP_HPP__
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief  添字付きd分ヒープ
+ *
+ * @note   要素は0以上n未満の整数(頂点など)であり、各要素は高々1つのキーとともにヒープに含まれる
+ *         位置配列pos[x]によって、要素xのヒープ上の位置をΟ(1)時間で求められるので、DECREASE-KEYとxがヒープに含まれるか否かの判定ができる
+ *         したがって、DijkstraやPrimのアルゴリズムで古い項目を残す必要がなく、ヒープの大きさは高々n = |V|である
+ *
+ * @note   各節点はd個の子を持つ. 節点iの子は節点d * i + 1, ..., d * i + dであり、親は節点(i - 1) / dである
+ *         木の高さはlog_d(n)なので、2分ヒープ(d = 2)と比べてINSERTとDECREASE-KEYで節点を上に移す回数が減る
+ *         EXTRACT-MINでは各段でd個の子を比べるが、それらは配列上で連続しているので(d = 4でキーと要素の対が1本のキャッシュ行に収まる)、
+ *         キャッシュミスは段の数、すなわちlog_d(n)に比例する. 実行時間はINSERTとDECREASE-KEYがΟ(log_d(n))、EXTRACT-MINがΟ(d log_d(n))である
+ *
+ * @tparam class Key     キーの型
+ * @tparam std::size_t D 各節点の子の数(arity)
+ * @tparam class Compare 比較用関数オブジェクト(デフォルトでminヒープを構築する. pqueueと同じ約束である)
+ */
+template <class Key,
+          std::size_t D   = 4,
+          class Compare   = std::greater<Key>
+          >
+struct dheap {
+    static_assert(D >= 2, "arity must be at least 2");
+    using item_t = std::int32_t;
+    using pair_t = std::pair<item_t, Key>;
+    enum : item_t { npos = -1 };  /**< ヒープに含まれない要素の位置 */
+
+    /**< @brief ヒープの節点(キーと要素) */
+    struct node {
+        Key    key;
+        item_t item;
+    };
+
+    std::vector<node>   A;    /**< d分木とみなせる配列A */
+    std::vector<item_t> pos;  /**< 要素xの節点の位置(ヒープに含まれなければnpos) */
+    Compare cmp;              /**< 比較述語 */
+
+    /**
+     * @param std::size_t n 要素の数(要素は0, 1, ..., n - 1である)
+     */
+    explicit dheap(std::size_t n) : pos(n, npos) { A.reserve(n); }
+
+    /**< @brief ヒープが空かどうかを返す */
+    bool empty() const { return A.empty(); }
+
+    /**< @brief ヒープに含まれる要素の数を返す */
+    std::size_t size() const { return A.size(); }
+
+    /**< @brief 要素xがヒープに含まれるか否かを返す */
+    bool contains(item_t x) const { return pos[x] != npos; }
+
+    /**< @brief ヒープに含まれる要素xのキーを返す */
+    const Key& key(item_t x) const { return A[pos[x]].key; }
+
+    /**< @brief 最小(最大)のキーを持つ(要素, キー)の対を返す */
+    pair_t top() const { return std::make_pair(A[0].item, A[0].key); }
+
+    /**
+     * @brief 要素xをキーkeyで挿入する
+     * @note  xはヒープに含まれていてはならない. 実行時間はΟ(log_d(n))
+     */
+    void insert(item_t x, const Key& key)
+    {
+        assert(!contains(x));
+        A.push_back(node{ key, x });
+        siftup(A.size() - 1);
+    }
+
+    /**
+     * @brief 要素xのキーの値を新しいキー値keyに変更する
+     * @note  minヒープにおいてkey <= x.keyを仮定する. 実行時間はΟ(log_d(n))
+     */
+    void decrease_key(item_t x, const Key& key)
+    {
+        assert(contains(x) && !cmp(key, A[pos[x]].key));
+        std::size_t i = pos[x];
+        A[i].key = key;
+        siftup(i);
+    }
+
+    /**
+     * @brief 要素xがヒープに含まれていればキーをkeyに減少させ、含まれていなければキーkeyで挿入する
+     */
+    void push(item_t x, const Key& key)
+    {
+        if (contains(x)) { decrease_key(x, key); }
+        else             { insert(x, key); }
+    }
+
+    /**
+     * @brief ヒープから最小(最大)のキーを持つ要素を削除し、(要素, キー)の対を返す
+     * @note  実行時間はΟ(d log_d(n))
+     */
+    pair_t extract()
+    {
+        assert(!empty());
+        pair_t top = this->top();
+        pos[top.first] = npos;
+        node last = A.back(); A.pop_back();
+        if (!A.empty()) { A[0] = last; siftdown(0); }
+        return top;
+    }
+
+    /**
+     * @brief ヒープを空にする
+     * @note  ヒープに残っている要素の位置だけを消すので、実行時間はΟ(size())である
+     */
+    void clear()
+    {
+        for (const auto& a : A) { pos[a.item] = npos; }
+        A.clear();
+    }
+
+private:
+    /**
+     * @brief 節点iを、親のキーが自身のキー以下になるまで根の方向に移す
+     * @note  節点を交換するのではなく、親を1段ずつ下に移して空いた位置に最後に書き込む
+     */
+    void siftup(std::size_t i)
+    {
+        node x = A[i];
+        while (i > 0) {
+            std::size_t p = (i - 1) / D;
+            if (!cmp(A[p].key, x.key)) { break; }
+            A[i] = A[p]; pos[A[i].item] = item_t(i);
+            i = p;
+        }
+        A[i] = x; pos[x.item] = item_t(i);
+    }
+
+    /**
+     * @brief 節点iを、すべての子のキーが自身のキー以上になるまで葉の方向に移す
+     */
+    void siftdown(std::size_t i)
+    {
+        node x = A[i];
+        std::size_t n = A.size();
+        while (true) {
+            std::size_t first = D * i + 1;
+            if (first >= n) { break; }
+            std::size_t last = first + D < n ? first + D : n, c = first;
+            for (std::size_t j = first + 1; j < last; j++) { c = cmp(A[c].key, A[j].key) ? j : c; }  // 最小の子を選ぶ
+            if (!cmp(x.key, A[c].key)) { break; }
+            A[i] = A[c]; pos[A[i].item] = item_t(i);
+            i = c;
+        }
+        A[i] = x; pos[x.item] = item_t(i);
+    }
+};
+
+
+
+#endif  // end of __DHEAP_HPP__
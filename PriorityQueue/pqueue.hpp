@@ -110,6 +110,15 @@ struct pqueue {
         return H.size == 0;
     }
 
+    /**
+     * @brief キューを空にする
+     * @note  確保済みの記憶領域はそのまま再利用する. 実行時間はΟ(1)
+     */
+    void clear()
+    {
+        H.size = 0;
+    }
+
     // template<class... Args>
     // void emplace(Args&&... args)
     // {
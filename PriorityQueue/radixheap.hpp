@@ -0,0 +1,108 @@
+/**
+ * @brief 基数ヒープ(radix heap)の実装
+ * @date  2026/10/15
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef __RADIXHEAP_HPP__
+#define __RADIXHEAP_HPP__
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief  基数ヒープ
+ *
+ * @note   基数ヒープは単調(monotone)なmin優先度付きキューである. すなわち、挿入するキーは
+ *         最後に取り出したキーlast以上でなければならない. Dijkstraのアルゴリズムは取り出すキーが
+ *         非減少なのでこの条件を満たす
+ *
+ * @note   キーxは、lastと比べて最上位の異なるビットの位置(x xor lastのビット長)によって33個のバケツB[0..32]に分類される
+ *         B[0]にはlastと等しいキーだけが入る. extractではB[0]が空ならば空でない最初のバケツB[i]を探し、
+ *         その最小キーを新たなlastとしてB[i]の要素を再分配する. このとき各要素は必ずより小さい番号のバケツに移るので、
+ *         1つの要素が再分配されるのは高々32回である. したがって、insertはΟ(1), extractはならしΟ(lgC)時間である
+ *         (Cはキーの最大値). 比較は整数演算だけで済み、2分ヒープよりもキャッシュミスが少ない
+ *
+ * @tparam class T 値の型
+ */
+template <class T>
+struct radixheap {
+    using key_t  = std::uint32_t;
+    using pair_t = std::pair<key_t, T>;
+    enum { buckets = 33 };
+
+    std::array<std::vector<pair_t>, buckets> B;  /**< バケツ */
+    key_t last;                                  /**< 最後に取り出したキー */
+    std::size_t size;                            /**< 格納されている要素数 */
+
+    radixheap() : last(0), size(0) {}
+
+    /**
+     * @brief 集合Sにキーkeyを持つ要素xを挿入する
+     * @note  key >= lastを仮定する. 実行時間はΟ(1)
+     */
+    void insert(key_t key, const T& x)
+    {
+        assert(key >= last);  // 単調性のチェック
+        B[bucket(key)].emplace_back(key, x);
+        size = size + 1;
+    }
+
+    /**
+     * @brief Sから最小のキーを持つ要素を削除し、その(キー, 要素)の対を返す
+     * @note  ならし実行時間はΟ(lgC)
+     */
+    pair_t extract()
+    {
+        assert(size > 0);  // アンダーフローチェック
+        if (B[0].empty()) {
+            std::size_t i = 1;
+            while (B[i].empty()) { i++; }  // 空でない最初のバケツを探し、
+            last = B[i][0].first;
+            for (auto& p : B[i]) { last = p.first < last ? p.first : last; }  // その最小キーをlastとして、
+            for (auto& p : B[i]) { B[bucket(p.first)].push_back(p); }       // 要素を再分配する
+            B[i].clear();
+        }
+        pair_t p = B[0].back();
+        B[0].pop_back();
+        size = size - 1;
+        return p;
+    }
+
+    /**< @brief キューが空かどうかを返す */
+    bool empty() const
+    {
+        return size == 0;
+    }
+
+private:
+    /**< @brief キーxが属するバケツの番号(x xor lastのビット長)を返す */
+    std::size_t bucket(key_t x) const
+    {
+        return x == last ? 0 : 32 - __builtin_clz(x ^ last);
+    }
+};
+
+
+
+#endif  // end of __RADIXHEAP_HPP__
@@ -0,0 +1,101 @@
+/**
+ * @brief  プッシュ再ラベルアルゴリズムの動作確認
+ * @date   2026/10/15
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include "pushrelabel.hpp"
+#include "../EdmondsKarp/edmondskarp.hpp"
+
+
+
+/**
+ * @brief  得られたフローが容量制限とフロー保存則を満たし、その値が最小カットの容量に等しいか確かめる
+ */
+bool verify(pushrelabel& P, index_t s, index_t t, capacity_t value)
+{
+    std::vector<std::int64_t> net(P.n, 0);
+    std::vector<char> inS(P.n, 0);
+    for (auto v : P.mincut()) { inS[v] = 1; }
+    std::int64_t cut = 0;
+    bool ok = inS[s] && !inS[t];
+    for (std::size_t i = 0; i < P.E.size(); i++) {
+        const edge& e = P.E[i];
+        capacity_t f = P.flow(i);
+        ok = ok && 0 <= f && f <= e.c;
+        net[e.src] -= f; net[e.dst] += f;
+        if (inS[e.src] && !inS[e.dst]) { cut += e.c; }
+    }
+    for (index_t v = 0; v < P.n; v++) {
+        if (v != s && v != t) { ok = ok && net[v] == 0; }
+    }
+    return ok && net[t] == value && cut == value;
+}
+
+
+
+int main(void)
+{
+    using namespace std;
+    using selection = pushrelabel::selection;
+
+    // CLRS 図26.1のフローネットワーク(最大フローは23)
+    pushrelabel P(6);
+    P.addedge(0, 1, 16); P.addedge(0, 2, 13); P.addedge(1, 3, 12); P.addedge(2, 1, 4);
+    P.addedge(2, 4, 14); P.addedge(3, 2, 9);  P.addedge(3, 5, 20); P.addedge(4, 3, 7); P.addedge(4, 5, 4);
+    cout << "max flow : " << P.execute(0, 5) << endl;
+    cout << "min cut  :";
+    for (auto v : P.mincut()) { cout << " " << v; }
+    cout << endl;
+
+    // 小さなランダムネットワークでEdmonds-Karpのアルゴリズムと比較する
+    mt19937 mt(1);
+    bool ok = true;
+    for (int trial = 0; trial < 200; trial++) {
+        const int n = 40, m = 200;
+        uniform_int_distribution<index_t>    vdist(0, n - 1);
+        uniform_int_distribution<capacity_t> cdist(1, 50);
+        edmondskarp EK(n);
+        pushrelabel F(n, selection::fifo), H(n, selection::highest);
+        for (int i = 0; i < m; i++) {
+            index_t u = vdist(mt), v = vdist(mt);
+            if (u == v) { continue; }
+            capacity_t c = cdist(mt);
+            if (EK.c[u][v] != 0 || EK.c[v][u] != 0) { continue; }  // edmondskarpは逆平行辺と多重辺を扱えない
+            EK.addedge(u, v, c); F.addedge(u, v, c); H.addedge(u, v, c);
+        }
+        capacity_t expected = EK.execute(0, n - 1);
+        capacity_t f = F.execute(0, n - 1), h = H.execute(0, n - 1);
+        ok = ok && f == expected && h == expected && verify(F, 0, n - 1, f) && verify(H, 0, n - 1, h);
+    }
+    cout << (ok ? "ok" : "ng") << endl;
+
+    // 10^5頂点の疎なネットワーク(行列で表せば40GBを要する)
+    const int n = 100000, m = 1000000;
+    uniform_int_distribution<index_t>    vdist(0, n - 1);
+    uniform_int_distribution<capacity_t> cdist(1, 1000);
+    edges_t E;
+    for (int i = 0; i < m; i++) { E.emplace_back(vdist(mt), vdist(mt), cdist(mt)); }
+    for (int i = 0; i < n / 10; i++) {  // 入口と出口の次数を大きくして、カットがネットワークの内部にできるようにする
+        E.emplace_back(0, vdist(mt), cdist(mt) * 10); E.emplace_back(vdist(mt), n - 1, cdist(mt) * 10);
+    }
+    for (selection rule : { selection::fifo, selection::highest }) {
+        pushrelabel R(n, rule);
+        for (auto& e : E) { R.addedge(e.src, e.dst, e.c); }
+        auto start = chrono::steady_clock::now();
+        capacity_t f = R.execute(0, n - 1);
+        auto stop  = chrono::steady_clock::now();
+        cout << (rule == selection::fifo ? "fifo    : " : "highest : ") << f << " ("
+             << chrono::duration<double, milli>(stop - start).count() << " ms, |S| = " << R.mincut().size() << ") "
+             << (verify(R, 0, n - 1, f) ? "ok" : "ng") << endl;
+    }
+    return 0;
+}
@@ -0,0 +1,291 @@
+/**
+ * @brief  最大フローを求めるプッシュ再ラベル(push-relabel)アルゴリズムを扱う
+ * @date   2026/10/15
+ */
+
+
+
+//****************************************
+// インクルードガード
+//****************************************
+
+#ifndef __PUSHRELABEL_HPP__
+#define __PUSHRELABEL_HPP__
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <cstdint>
+#include <algorithm>
+#include <vector>
+#include "../Graph/graph.hpp"
+#include "../Graph/residual.hpp"
+#include "../Queue/queue.hpp"
+
+
+
+//****************************************
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief プッシュ再ラベルアルゴリズム
+ *
+ * @note  Ford-Fulkerson法が増加可能経路に沿ってフローを流すのに対し、プッシュ再ラベルアルゴリズムは1頂点ずつ局所的に操作する
+ *        アルゴリズムはフロー保存則を緩めた先行フロー(preflow)を管理する. 先行フローでは頂点uへの流入が流出を上回ってよく、
+ *        その差を超過量(excess)u.eと呼ぶ. u.e > 0である頂点(s, t以外)を活性(active)であると言う
+ *        各頂点には高さ(ラベル)u.hを付け、残余辺(u, v)はu.h = v.h + 1のときに限り許容(admissible)であるとする
+ *          PUSH(u, v)  : 活性なuから許容辺(u, v)にmin(u.e, cf(u, v))だけフローを押し出す
+ *          RELABEL(u)  : 活性なuに許容辺がなければ、u.h = 1 + min{ v.h : cf(u, v) > 0 }とする
+ *        を適用できなくなるまで繰り返すと、先行フローは最大フローになる
+ *
+ * @note  次の3つの工夫を加える
+ *          活性頂点の選択 : FIFO(活性になった順)または最高ラベル(最も高い活性頂点から)を選べる. 最高ラベル規則の実行時間はΟ(V^2√E)である
+ *          大域的再ラベル : 定期的に、残余ネットワーク上でtから逆向きに幅優先探索し、高さをtへの距離に置き換える
+ *          ギャップ発見   : ある高さkの頂点がなくなれば、高さがkより大きい頂点はtに到達できないので、高さを|V|に上げる
+ *        高さが|V|以上になった頂点からはtに到達できない. 第1段階ではそのような頂点を処理しない(最小カットはこの時点で求まる)
+ *        第2段階で、残った超過量をsに送り返して先行フローをフローにする
+ *
+ * @note  残余ネットワークは疎な表現(residualgraph)を用いるので、記憶量はΘ(V + E)である
+ */
+struct pushrelabel {
+    /**< @brief 活性頂点の選択規則 */
+    enum struct selection { fifo, highest };
+
+    std::int32_t n;                   /**< 頂点v ∈ Vの数 */
+    selection    rule;                /**< 活性頂点の選択規則 */
+    edges_t      E;                   /**< 辺(u, v) ∈ Eとその容量 */
+    residualgraph Gf;                 /**< 残余ネットワークGf */
+    indices_t    h;                   /**< 頂点の高さ */
+    std::vector<std::int64_t> e;      /**< 頂点の超過量 */
+    offsets_t    cur;                 /**< 頂点の現在の辺(current arc) */
+
+    explicit pushrelabel(std::size_t size, selection rule = selection::highest) : n(size), rule(rule) {}
+    explicit pushrelabel(const graph_t& G, selection rule = selection::highest) : pushrelabel(G.size(), rule)
+    {
+        for (index_t i = 0; i < n; i++) { for (auto& e : G[i]) { addedge(e.src, e.dst, e.c); } }
+    }
+
+    /**
+     * @brief  容量capの辺(u, v)を加える
+     */
+    void addedge(index_t u, index_t v, capacity_t cap)
+    {
+        E.emplace_back(u, v, cap);
+    }
+
+    /**
+     * @brief  プッシュ再ラベルアルゴリズムを実行する
+     * @param  index_t s フローネットワークの入口(source) s
+     * @param  index_t t フローネットワークの出口(sink) t
+     * @return フローネットワークの最大フロー
+     */
+    capacity_t execute(index_t s, index_t t)
+    {
+        Gf = residualgraph(n, E);
+        h.assign(n, 0); e.assign(n, 0); cur.assign(Gf.offsets.begin(), Gf.offsets.end() - 1);
+        if (s == t) { return 0; }
+        preflow(s, t);
+        return e[t];
+    }
+
+    /**
+     * @brief  i番目に加えた辺のフローを返す
+     */
+    capacity_t flow(std::size_t i) const
+    {
+        return E[i].c - Gf.arcs[Gf.forward[i]].cf;
+    }
+
+    /**
+     * @brief  最小カット(S, T)の入口側の頂点集合Sを返す
+     * @note   Sは残余ネットワークでtに到達できない頂点全体であり、s ∈ Sである
+     *         executeの後に呼び出すこと. 辺(u, v)がu ∈ S, v ∈ Tならば、その辺は飽和している
+     */
+    indices_t mincut() const
+    {
+        indices_t S;
+        for (index_t v = 0; v < n; v++) { if (h[v] >= n) { S.push_back(v); } }
+        return S;
+    }
+
+private:
+    /**
+     * @brief  残余ネットワーク上でsinkから逆向きに幅優先探索し、各頂点の高さをsinkへの距離とする
+     * @note   sinkに到達できない頂点の高さはunreachとする. 実行時間はΘ(V + E)である
+     */
+    void globalrelabel(index_t sink, index_t unreach, index_t skip)
+    {
+        h.assign(n, unreach);
+        queue<index_t> Q(n);
+        h[sink] = 0; Q.enqueue(sink);
+        while (!Q.empty()) {
+            index_t v = Q.dequeue();
+            for (offset_t a = Gf.begin(v); a < Gf.end(v); a++) {
+                index_t u = Gf.arcs[a].dst;
+                // 残余辺(u, v)が存在すれば、uの高さはv.h + 1以下にできる
+                if (h[u] == unreach && u != skip && Gf.arcs[Gf.arcs[a].rev].cf > 0) {
+                    h[u] = h[v] + 1; Q.enqueue(u);
+                }
+            }
+        }
+        for (index_t v = 0; v < n; v++) { cur[v] = Gf.begin(v); }
+    }
+
+    /**
+     * @brief  第1段階 : tに到達できる頂点に超過量がなくなるまでPUSHとRELABELを繰り返す
+     */
+    void preflow(index_t s, index_t t)
+    {
+        // 高さkの頂点の双方向連結リストと、高さkの活性頂点のリスト(最高ラベル規則)またはキュー(FIFO規則)
+        indices_t lhead(n + 1), lnext(n), lprev(n), ahead(n + 1), anext(n);
+        queue<index_t> Q(n);
+        index_t hmax = 0, amax = 0;  // 頂点の最大の高さと、活性頂点の最大の高さ(n未満のもの)
+        std::int64_t work = 0;
+
+        auto link = [&](index_t v) {
+            index_t k = h[v];
+            lnext[v] = lhead[k]; lprev[v] = graph::nil;
+            if (lhead[k] != graph::nil) { lprev[lhead[k]] = v; }
+            lhead[k] = v; hmax = std::max(hmax, k);
+        };
+        auto unlink = [&](index_t v) {
+            if (lprev[v] != graph::nil) { lnext[lprev[v]] = lnext[v]; } else { lhead[h[v]] = lnext[v]; }
+            if (lnext[v] != graph::nil) { lprev[lnext[v]] = lprev[v]; }
+        };
+        auto activate = [&](index_t v) {
+            if (h[v] >= n) { return; }
+            if (rule == selection::fifo) { Q.enqueue(v); }
+            else { anext[v] = ahead[h[v]]; ahead[h[v]] = v; amax = std::max(amax, h[v]); }
+        };
+        auto next = [&]() -> index_t {
+            if (rule == selection::fifo) {
+                while (!Q.empty()) { index_t v = Q.dequeue(); if (h[v] < n) { return v; } }
+                return graph::nil;
+            }
+            for (; amax >= 0; amax--) {
+                if (ahead[amax] != graph::nil) { index_t v = ahead[amax]; ahead[amax] = anext[v]; return v; }
+            }
+            amax = 0;
+            return graph::nil;
+        };
+        // 高さをtへの距離に置き換え、リストを作り直す
+        auto rebuild = [&]() {
+            globalrelabel(t, n, s);
+            h[s] = n;
+            std::fill(lhead.begin(), lhead.end(), graph::nil);
+            std::fill(ahead.begin(), ahead.end(), graph::nil);
+            hmax = 0; amax = 0;
+            if (rule == selection::fifo) { while (!Q.empty()) { Q.dequeue(); } }
+            for (index_t v = 0; v < n; v++) {
+                if (v == s || h[v] >= n) { continue; }
+                link(v);
+                if (v != t && e[v] > 0) { activate(v); }
+            }
+            work = 0;
+        };
+        // 高さkの頂点がなくなったので、高さがkより大きい頂点をすべてnに上げる
+        auto gap = [&](index_t k) {
+            for (index_t j = k + 1; j <= hmax; j++) {
+                for (index_t v = lhead[j]; v != graph::nil; v = lnext[v]) { h[v] = n; }
+                lhead[j] = graph::nil; ahead[j] = graph::nil;
+            }
+            hmax = k - 1; amax = std::min(amax, hmax);
+        };
+        // 活性頂点uの超過量がなくなるか、uがtに到達できなくなるまでPUSHとRELABELを繰り返す
+        auto discharge = [&](index_t u) {
+            while (e[u] > 0) {
+                if (cur[u] == Gf.end(u)) {  // RELABEL(u)
+                    index_t k = h[u], m = n;
+                    for (offset_t a = Gf.begin(u); a < Gf.end(u); a++) {
+                        if (Gf.arcs[a].cf > 0) { m = std::min(m, h[Gf.arcs[a].dst] + 1); }
+                    }
+                    unlink(u);
+                    work += Gf.end(u) - Gf.begin(u) + 12;
+                    if (lhead[k] == graph::nil) { gap(k); h[u] = n; }  // uはkの唯一の頂点だった
+                    else { h[u] = m; }
+                    if (h[u] >= n) { return; }
+                    link(u); cur[u] = Gf.begin(u);
+                    continue;
+                }
+                residualarc& a = Gf.arcs[cur[u]];
+                index_t v = a.dst;
+                if (a.cf > 0 && h[u] == h[v] + 1) {  // PUSH(u, v)
+                    capacity_t delta = capacity_t(std::min<std::int64_t>(e[u], a.cf));
+                    Gf.push(cur[u], delta);
+                    e[u] -= delta;
+                    if (e[v] == 0 && v != t && v != s) { activate(v); }
+                    e[v] += delta;
+                }
+                else {
+                    cur[u]++;
+                }
+            }
+        };
+
+
+        // sから出る辺をすべて飽和させて先行フローを初期化する
+        for (offset_t a = Gf.begin(s); a < Gf.end(s); a++) {
+            capacity_t c = Gf.arcs[a].cf;
+            if (c > 0) { Gf.push(a, c); e[s] -= c; e[Gf.arcs[a].dst] += c; }
+        }
+        rebuild();
+        for (index_t u = next(); u != graph::nil; u = next()) {
+            discharge(u);
+            if (e[u] > 0 && h[u] < n) { activate(u); }
+            if (work > 6 * std::int64_t(n) + std::int64_t(Gf.arcs.size()) / 2) { rebuild(); }  // 大域的再ラベル
+        }
+        // ここで、高さがn未満の頂点はすべてtに到達でき、超過量を持たない
+        // 高さがn以上の頂点はtに到達できない頂点の集合Sであり、(S, V - S)は最小カットである
+        globalrelabel(t, n, graph::nil);
+        h[s] = n;
+        indices_t cut = h;
+        returnexcess(s, t);
+        h = cut;
+    }
+
+    /**
+     * @brief  第2段階 : tに到達できない頂点に残った超過量をsに送り返し、先行フローをフローにする
+     * @note   超過量を持つ頂点はいずれも残余ネットワークでsに到達できるので、sを出口としたFIFO規則のプッシュ再ラベルを行えばよい
+     */
+    void returnexcess(index_t s, index_t t)
+    {
+        globalrelabel(s, 2 * n, t);
+        queue<index_t> Q(n);
+        std::vector<char> inqueue(n, 0);
+        for (index_t v = 0; v < n; v++) {
+            if (v != s && v != t && e[v] > 0) { Q.enqueue(v); inqueue[v] = 1; }
+        }
+        while (!Q.empty()) {
+            index_t u = Q.dequeue(); inqueue[u] = 0;
+            while (e[u] > 0) {
+                if (cur[u] == Gf.end(u)) {
+                    index_t m = 2 * n;
+                    for (offset_t a = Gf.begin(u); a < Gf.end(u); a++) {
+                        if (Gf.arcs[a].cf > 0 && Gf.arcs[a].dst != t) { m = std::min(m, h[Gf.arcs[a].dst] + 1); }
+                    }
+                    h[u] = m; cur[u] = Gf.begin(u);
+                    continue;
+                }
+                residualarc& a = Gf.arcs[cur[u]];
+                index_t v = a.dst;
+                if (a.cf > 0 && v != t && h[u] == h[v] + 1) {
+                    capacity_t delta = capacity_t(std::min<std::int64_t>(e[u], a.cf));
+                    Gf.push(cur[u], delta);
+                    e[u] -= delta; e[v] += delta;
+                    if (v != s && !inqueue[v]) { Q.enqueue(v); inqueue[v] = 1; }
+                }
+                else {
+                    cur[u]++;
+                }
+            }
+        }
+    }
+};
+
+
+
+#endif  // end of __PUSHRELABEL_HPP__
@@ -0,0 +1,128 @@
+/**
+ * @brief  頂点の番号の付け替えの動作確認
+ *
+ * @note   無作為な番号を付けたR-MATグラフと2次元格子グラフについて、各順列で番号を付け替え、
+ *         辺の両端点の番号の差の対数の平均(小さいほど隣接する頂点がメモリ上で近い)と、bfsおよびdijkstraの実行時間を比較する
+ *         また、付け替えたグラフ上の結果を元の番号に戻し、元のグラフ上の結果と一致することを確かめる
+ *
+ * @date   2026/10/15
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <string>
+#include "../Graph/reorder.hpp"
+#include "../Graph/generator.hpp"
+#include "../BFS/bfs.hpp"
+#include "../Dijkstra/dijkstra.hpp"
+
+
+
+//****************************************
+// 関数の定義
+//****************************************
+
+/**
+ * @brief  辺(u, v)の両端点の番号の差の対数lg(|u - v| + 1)の平均を返す
+ */
+double averagegap(const csrgraph& G)
+{
+    std::int32_t n = G.size();
+    double sum = 0.0;
+    for (index_t u = 0; u < n; u++) {
+        for (const auto& e : G[u]) { sum += std::log2(std::abs(double(u) - e.dst) + 1.0); }
+    }
+    return G.edges() ? sum / G.edges() : 0.0;
+}
+
+
+/**
+ * @brief  fを3回実行し、最短の実行時間を返す
+ */
+double seconds(const std::function<void()>& f)
+{
+    double best = 1e300;
+    for (std::int32_t r = 0; r < 3; r++) {
+        auto start = std::chrono::steady_clock::now();
+        f();
+        best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    }
+    return best;
+}
+
+
+/**
+ * @brief  各順列で番号を付け替えたグラフについて測定し、結果を元のグラフ上の結果と比較する
+ */
+void run(const std::string& name, std::int32_t n, const edges_t& E)
+{
+    csrgraph G(n, E);
+    index_t  s = 0;
+    for (index_t v = 0; v < n; v++) { if (G.degree(v) > G.degree(s)) { s = v; } }
+    vertices_t B = bfs(G, s), D = dijkstra(G, s);
+
+    std::printf("%s: n = %d, m = %zu\n", name.c_str(), n, G.edges());
+    std::printf("  %-8s %8s %10s %10s %10s %s\n", "order", "lg gap", "reorder", "bfs", "dijkstra", "check");
+    indices_t identity(n);
+    std::iota(identity.begin(), identity.end(), 0);
+    std::pair<const char*, std::function<indices_t()>> orders[] = {
+        { "input",  [&]() { return identity; } },
+        { "degree", [&]() { return degreeorder(G); } },
+        { "bfs",    [&]() { return bfsorder(G); } },
+        { "rcm",    [&]() { return rcmorder(G); } },
+    };
+    for (auto& o : orders) {
+        indices_t perm; csrgraph H;
+        double tr = seconds([&]() { perm = o.second(); H = permute(G, perm); });
+        vertices_t B2, D2;
+        double tb = seconds([&]() { B2 = bfs(H, perm[s]); });
+        double td = seconds([&]() { D2 = dijkstra(H, perm[s]); });
+        B2 = unpermute(B2, perm); D2 = unpermute(D2, perm);
+
+        // 距離が一致し、元の番号に戻した先行点が元のグラフの辺で最短路木を成すことを確かめる
+        bool ok = true;
+        for (index_t v = 0; v < n; v++) {
+            ok = ok && B2[v].d == B[v].d && D2[v].d == D[v].d;
+            index_t p = D2[v].pi;
+            if (p != graph::nil) {
+                bool found = false;
+                for (const auto& e : G[p]) { found = found || (e.dst == v && D[p].d + e.w == D[v].d); }
+                ok = ok && found;
+            }
+        }
+        std::printf("  %-8s %8.2f %10.4f %10.4f %10.4f %s\n", o.first, averagegap(H), tr, tb, td, ok ? "ok" : "NG");
+    }
+}
+
+
+
+int main(int argc, char* argv[])
+{
+    std::int32_t scale = argc > 1 ? std::atoi(argv[1]) : 18;
+    std::int32_t n = 1 << scale;
+    std::mt19937 mt(1);
+
+    // R-MATグラフ(生成器が頂点番号を無作為に置換している)
+    edges_t R = rmat(scale, 8, mt);
+    randomweights(R, 1, 100, mt);
+    run("rmat", n, R);
+
+    // 2次元格子グラフの頂点番号を無作為に置換したもの
+    edges_t S = grid2d(1 << (scale / 2), 1 << (scale - scale / 2));
+    randomweights(S, 1, 100, mt);
+    indices_t shuffle(n);
+    std::iota(shuffle.begin(), shuffle.end(), 0);
+    for (index_t i = n - 1; i > 0; i--) { std::swap(shuffle[i], shuffle[uniformindex(mt, i + 1)]); }
+    for (auto& e : S) { e.src = shuffle[e.src]; e.dst = shuffle[e.dst]; }
+    run("grid", n, S);
+    return 0;
+}
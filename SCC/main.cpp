@@ -9,8 +9,11 @@
 // 必要なヘッダファイルのインクルード
 //****************************************
 
+#include <algorithm>
 #include <iostream>
+#include <random>
 #include "scc.hpp"
+#include "../Graph/csr.hpp"
 
 
 
@@ -18,6 +21,21 @@
 // 関数の定義
 //****************************************
 
+/**
+ * @brief  2つの成分番号の列が同じ分割を表すか否かを返す
+ */
+bool samepartition(const indices_t& a, const indices_t& b)
+{
+    std::size_t n = a.size();
+    indices_t f(n, graph::nil), g(n, graph::nil);
+    for (std::size_t v = 0; v < n; v++) {
+        if (f[a[v]] == graph::nil) { f[a[v]] = b[v]; }
+        if (g[b[v]] == graph::nil) { g[b[v]] = a[v]; }
+        if (f[a[v]] != b[v] || g[b[v]] != a[v]) { return false; }
+    }
+    return true;
+}
+
 
 
 int main(void)
@@ -49,6 +67,49 @@ int main(void)
         std::cout << c << " ";
     }
     std::cout << std::endl;
+
+    // CSR表現に変換しても同じ強連結成分が得られる
+    for (auto c : scc(csrgraph(G))) {
+        std::cout << c << " ";
+    }
+    std::cout << std::endl;
+
+    // 反復版のTarjanのアルゴリズムと、前向き・後ろ向き探索と彩色による並列版
+    for (auto c : tarjanscc(G)) { std::cout << c << " "; }
+    std::cout << std::endl;
+    for (auto c : fwbwscc(csrgraph(G))) { std::cout << c << " "; }
+    std::cout << std::endl;
+
+    // ランダムなグラフ(巨大な成分と多数の小さな成分をもつ)で3つのアルゴリズムを比較する
+    const index_t rs = 1 << 16;
+    std::mt19937 mt(1);
+    std::uniform_int_distribution<index_t> vdist(0, rs - 1);
+    graph_t R(rs);
+    for (int i = 0; i < rs + rs / 4; i++) { index_t u = vdist(mt), v = vdist(mt); R[u].emplace_back(u, v); }
+    csrgraph C(R);
+    auto a = scc(C), b = tarjanscc(C), c = fwbwscc(C);
+    std::cout << "random : " << (samepartition(a, b) && a == b ? "ok" : "ng") << " "
+              << (samepartition(a, c) ? "ok" : "ng") << std::endl;
+
+    // 長さ10^6の閉路. 深さ優先木の深さが|V|になるが、反復版は呼び出しスタックを使わない
+    const index_t cs = 1000000;
+    graph_t Z(cs);
+    for (index_t u = 0; u < cs; u++) { Z[u].emplace_back(u, (u + 1) % cs); }
+    Z[cs / 2].emplace_back(cs / 2, cs - 1);
+    auto t = tarjanscc(Z), f = fwbwscc(Z);
+    std::cout << "cycle  : " << *std::max_element(t.begin(), t.end()) + 1 << " " << *std::max_element(f.begin(), f.end()) + 1
+              << " " << (samepartition(t, f) ? "ok" : "ng") << std::endl;
+    Z[cs / 2].clear(); Z[cs - 1].clear();  // 長さ10^6の道(すべての頂点がそれぞれ1つの成分をなす)
+    t = tarjanscc(Z); f = fwbwscc(Z);
+    std::cout << "path   : " << *std::max_element(t.begin(), t.end()) + 1 << " " << *std::max_element(f.begin(), f.end()) + 1
+              << " " << (samepartition(t, f) ? "ok" : "ng") << std::endl;
+
+    // 長さ2の閉路を10^6 / 2個つないだ鎖. 刈り込みでは分解できず、前向き・後ろ向き探索の分割の深さが問題になる
+    for (index_t u = 0; u < cs; u++) { Z[u].clear(); }
+    for (index_t u = 0; u + 1 < cs; u++) { Z[u].emplace_back(u, u + 1); if (u % 2 == 0) { Z[u + 1].emplace_back(u + 1, u); } }
+    t = tarjanscc(Z); f = fwbwscc(Z);
+    std::cout << "chain  : " << *std::max_element(t.begin(), t.end()) + 1 << " " << *std::max_element(f.begin(), f.end()) + 1
+              << " " << (samepartition(t, f) ? "ok" : "ng") << std::endl;
 }
 
 
@@ -19,16 +19,21 @@
 // 必要なヘッダファイルのインクルード
 //****************************************
 
+#include <algorithm>
+#include <cstdint>
+#include <vector>
 #include "../Graph/graph.hpp"
+#include "../Graph/atomic.hpp"
+#include "../Graph/csr.hpp"
 #include "../Topologicalsort/tsort.hpp"
 
 
 
 //****************************************
-// 関数プロトタイプ
+// 関数の定義
 //****************************************
 
- /**
+/**
  * @brief  強連結成分(分解)アルゴリズム
  *
  * @note   グラフを強連結成分に分解した後、個々の強連結成分上でアルゴリズムを実行し、
@@ -49,11 +54,292 @@
  *         3 DFS(G^T)を呼び出すが、DFSの主ループでは(第1行で計算した)u.fの降順で頂点を探索する
  *         4 第3行で生成した深さ優先森の各木の頂点を、それぞれ分離された強連結成分として出力する
  *
- * @param  const graph& G グラフG
+ * @tparam Graph グラフの表現(graph_tまたはcsrgraph)
+ * @param  const Graph& G グラフG
  * @return components[v] 頂点vが含まれる連結成分の番号となるような集合
  */
-std::vector<index_t> scc(const graph_t& G);
+template <class Graph>
+std::vector<index_t> scc(const Graph& G)
+{
+    std::int32_t n = G.size(); vertices_t vs(n);
+    indices_t components(n, -1);
+    std::vector<color> _color(n, color::white);
+    graph_t GT(n);
+
+    // G^T上でuから到達できる白頂点に成分の番号kを付ける(深さ優先木の頂点の集合だけが必要なので、訪問の順序は問わない)
+    indices_t P;
+    auto visit = [&](index_t u, index_t k) {
+        _color[u] = color::gray; components[u] = k; P.push_back(u);
+        while (!P.empty()) {
+            index_t v = P.back(); P.pop_back();
+            for (const auto& e : GT[v]) {
+                index_t w = e.dst;
+                if (_color[w] == color::white) { _color[w] = color::gray; components[w] = k; P.push_back(w); }
+            }
+            _color[v] = color::black;
+        }
+    };
+
+
+    // DFS(G)を呼び出し、各頂点uに対して終了時刻u.fを計算する
+    array_t tlst = tsort(G);
+
+    // G^Tを計算する
+    for (index_t u = 0; u < n; u++) {
+        for (const auto& e : G[u]) {
+            GT[e.dst].emplace_back(e.dst, e.src);
+        }
+    }
+
+    // DFS(G^T)を呼び出す
+    index_t k = 0;
+    for (auto u : tlst) { // 成分グラフの頂点をトポロジカルソートされた順序で訪問する
+        if (_color[u] == color::white) {
+            visit(u, k++);
+        }
+    }
+
+    // 分離された強連結成分を出力
+    return components;
+}
+
+
+/**
+ * @brief  Tarjanのアルゴリズム(Pearceによる省メモリ版)による強連結成分分解
+ *
+ * @note   sccは深さ優先探索を2回行い、2回目のためにG^Tを生成する
+ *         Tarjanのアルゴリズムは深さ優先探索を1回だけ行い、G^Tを必要としない. 各頂点vについて、
+ *         vの子孫から(まだ成分が確定していない頂点への)辺を1本たどって到達できる頂点の最小の発見順序v.rindexを求めると、
+ *         v.rindexがv自身の発見順序に等しい頂点vが強連結成分の根であり、vより後に発見されて未確定の頂点が成分をなす
+ *
+ * @note   Pearceの変形では、発見順序とv.rindexを1つの配列で兼ね、成分が確定した頂点のrindexには成分の番号
+ *         (|V| - 1から降順に割り当てる. 常に未使用の発見順序より大きい)を書き込む. 従って、頂点ごとの作業領域は
+ *         rindexの1語だけで済む. 深さ優先探索は(頂点, 次に調べる辺の位置)を積んだ明示的なスタックで行う
+ *
+ * @note   成分はトポロジカルソートの逆順に確定する. 番号を付け直し、sccと同じく成分グラフのトポロジカルソートの順に
+ *         0, 1, ...と番号付ける. 実行時間はΘ(V + E)である
+ *
+ * @tparam Graph グラフの表現(graph_tまたはcsrgraph)
+ * @param  const Graph& G グラフG
+ * @return components[v] 頂点vが含まれる強連結成分の番号となるような集合
+ */
+template <class Graph>
+std::vector<index_t> tarjanscc(const Graph& G)
+{
+    struct frame { index_t v; std::size_t i; bool root; };  // 頂点v, 次に調べるvの辺の位置, vが成分の根である可能性
+    std::int32_t n = G.size();
+    indices_t rindex(n, 0);  // 0ならば未発見
+    indices_t S;             // 成分が未確定の頂点のスタック
+    std::vector<frame> P;    // 深さ優先探索の呼び出しスタック
+    index_t index = 1, c = n - 1;
+
+    for (index_t s = 0; s < n; s++) {
+        if (rindex[s] != 0) { continue; }
+        rindex[s] = index++; P.push_back(frame{ s, 0, true });
+        while (!P.empty()) {
+            frame& f = P.back();
+            index_t v = f.v;
+            if (f.i < G[v].size()) {  // vの次の辺(v, w)を調べる
+                index_t w = G[v][f.i++].dst;
+                if (rindex[w] == 0) {  // wを発見し、wを訪問する
+                    rindex[w] = index++; P.push_back(frame{ w, 0, true });
+                }
+                else if (rindex[w] < rindex[v]) { rindex[v] = rindex[w]; f.root = false; }
+                continue;
+            }
+            // vの辺を調べ尽くした
+            if (f.root) {  // vは成分の根なので、Sの中でvより後に発見された頂点とvを1つの成分とする
+                index--;
+                while (!S.empty() && rindex[v] <= rindex[S.back()]) {
+                    rindex[S.back()] = c; S.pop_back(); index--;
+                }
+                rindex[v] = c--;
+            }
+            else {
+                S.push_back(v);
+            }
+            P.pop_back();
+            if (!P.empty() && rindex[v] < rindex[P.back().v]) {  // 親に戻り、親のrindexを更新する
+                rindex[P.back().v] = rindex[v]; P.back().root = false;
+            }
+        }
+    }
+
+    // 確定した順にn - 1, n - 2, ..., c + 1と番号付けられているので、トポロジカルソートの順に付け直す
+    for (auto& r : rindex) { r -= c + 1; }
+    return rindex;
+}
+
+
+/**
+ * @brief  マルチスレッド化された前向き・後ろ向き探索(forward-backward)と刈り込み(trim)による強連結成分分解
+ *
+ * @note   頂点vを含む強連結成分は、vから到達できる頂点の集合FとG^T上でvから到達できる頂点の集合Bの共通部分F ∩ Bである
+ *         F, Bは並列な幅優先探索で求められる. さらに、F \ B, B \ F, V \ (F ∪ B)の3つの集合はそれぞれ強連結成分の和集合であり、
+ *         1つの成分が2つの集合にまたがることはない. そこで、まだ成分の定まらない頂点を「色」で互いに素な部分問題に分け、
+ *         次の2段階を成分の定まらない頂点がなくなるまで繰り返す
+ *           1. 刈り込み : 同じ色の頂点の間で入次数または出次数が0の頂点は、それだけで1つの成分をなす
+ *                         刈り込んだ頂点の隣接頂点の次数を減らし、新たに0になった頂点を続けて刈り込む(作業リストによるΟ(V + E)時間の処理)
+ *           2. 前向き・後ろ向き探索 : 各色から軸(pivot)pを1つずつ選び、すべての色で同時にF ∩ Bをpの成分とする
+ *                                     残りの頂点にはF \ B, B \ F, V \ (F ∪ B)ごとに新しい色を与える(色を分割し、始めから彩色し直すことはしない)
+ *         最初の軸は入次数と出次数の積が最大の頂点とし、巨大な成分を一度に取り除く. 以降の軸は頂点番号のハッシュ値が最小の頂点とする
+ *
+ * @note   各反復の手間は成分の定まらない頂点とその辺の数に比例する. 道や有向非巡回グラフのような部分は刈り込みだけで分解されるので、
+ *         反復の回数は増えない. 反復の回数は色の分割の深さであり、軸を無作為に選ぶことに相当するので、小さな成分が鎖状に並ぶ場合でも
+ *         期待値では対数程度である(最悪の場合はΟ(V)回である). 探索の段のフロンティアが小さい間はスレッドを起こさずに逐次的に処理する
+ *         G^Tは始点だけを持つCSR形式で内部に構築する
+ *
+ * @note   成分の番号は、各成分に属する最小の頂点の順に0, 1, ...と付ける(スレッドの数やスケジュールによらず決定的である)
+ *
+ * @tparam Graph グラフの表現(graph_tまたはcsrgraph)
+ * @param  const Graph& G グラフG
+ * @return components[v] 頂点vが含まれる強連結成分の番号となるような集合
+ */
+template <class Graph>
+std::vector<index_t> fwbwscc(const Graph& G)
+{
+    using count_t = std::int64_t;
+    using key_t   = std::uint64_t;
+    std::int32_t n = G.size();
+
+    // G^Tを構築する(rsrc[roffsets[v]..roffsets[v+1]-1]が辺(u, v)の始点u)
+    offsets_t roffsets(n + 1, 0); indices_t rsrc;
+    for (index_t u = 0; u < n; u++) { for (const auto& e : G[u]) { roffsets[e.dst + 1]++; } }
+    for (index_t v = 0; v < n; v++) { roffsets[v + 1] += roffsets[v]; }
+    rsrc.resize(roffsets[n]);
+    {
+        offsets_t pos(roffsets.begin(), roffsets.end() - 1);
+        for (index_t u = 0; u < n; u++) { for (const auto& e : G[u]) { rsrc[pos[e.dst]++] = u; } }
+    }
+    auto forward  = [&G](index_t u, auto f) { for (const auto& e : G[u]) { f(e.dst); } };
+    auto backward = [&](index_t v, auto f) { for (offset_t a = roffsets[v]; a < roffsets[v + 1]; a++) { f(rsrc[a]); } };
+
+    indices_t comp(n, graph::nil);  // 各頂点の成分の代表の頂点(未確定ならばNIL)
+    indices_t color(n, 0);          // 成分の定まらない頂点の色(色の番号は、その色が作られたときに属していた頂点のいずれか)
+    indices_t front(n), next(n);
+
+    // front[0..nf-1]から始めて、expand(v, push)がpushした頂点を幅優先に処理する. pushする頂点は呼び出し側で重複なく選ぶ
+    auto sweep = [&](count_t nf, auto expand) {
+        while (nf > 0) {
+            count_t tail = 0;
+            if (nf < 1024) {  // フロンティアが小さい間はスレッドを起こさない
+                for (count_t i = 0; i < nf; i++) { expand(front[i], [&](index_t w) { next[tail++] = w; }); }
+            } else {
+#pragma omp parallel
+                {
+                    indices_t local;
+#pragma omp for schedule(dynamic, 64) nowait
+                    for (count_t i = 0; i < nf; i++) {
+                        expand(front[i], [&](index_t w) { local.push_back(w); });
+                    }
+                    count_t i = fetch_add(&tail, count_t(local.size()));
+                    std::copy(local.begin(), local.end(), next.begin() + i);
+                }
+            }
+            front.swap(next); nf = tail;
+        }
+    };
+
+    indices_t active(n), indeg(n), outdeg(n);
+    std::vector<std::uint8_t> fw(n), bw(n);
+    std::vector<key_t> pivot(n), group(n);
+    indices_t rep(3 * count_t(n));
+    for (index_t v = 0; v < n; v++) { active[v] = v; }
+
+    for (bool first = true; !active.empty(); first = false) {
+        count_t m = active.size();
+
+        // 1. 刈り込み. 同じ色の成分の定まらない頂点との間の入次数と出次数を数え、どちらかが0の頂点から刈り込む
+#pragma omp parallel for schedule(dynamic, 64)
+        for (count_t i = 0; i < m; i++) {
+            index_t v = active[i], in = 0, out = 0;
+            forward(v,  [&](index_t w) { if (comp[w] == graph::nil && color[w] == color[v]) { out++; } });
+            backward(v, [&](index_t w) { if (comp[w] == graph::nil && color[w] == color[v]) { in++; } });
+            indeg[v] = in; outdeg[v] = out;
+        }
+        count_t nf = 0;
+        for (auto v : active) { if (indeg[v] == 0 || outdeg[v] == 0) { front[nf++] = v; } }
+        for (count_t i = 0; i < nf; i++) { comp[front[i]] = front[i]; }
+        sweep(nf, [&](index_t v, auto push) {
+            auto drop = [&](index_t w, index_t* deg) {
+                if (atomic_load(&comp[w]) == graph::nil && color[w] == color[v] && fetch_add(deg, index_t(-1)) == 1 &&
+                    cas(&comp[w], index_t(graph::nil), w)) { push(w); }
+            };
+            forward(v,  [&](index_t w) { drop(w, &indeg[w]); });
+            backward(v, [&](index_t w) { drop(w, &outdeg[w]); });
+        });
+        active.erase(std::remove_if(active.begin(), active.end(), [&](index_t v) { return comp[v] != graph::nil; }),
+                     active.end());
+        if (active.empty()) { break; }
+        m = active.size();
+
+        // 2. 各色の軸を選ぶ(上位32ビットに優先度、下位32ビットに頂点を持つ語の最小値をとる)
+        auto priority = [&](index_t v) -> std::uint32_t {
+            if (first) {  // 入次数と出次数の積が大きいほど優先する
+                count_t x = count_t(G[v].size()) * (roffsets[v + 1] - roffsets[v]);
+                return UINT32_MAX - std::uint32_t(std::min<count_t>(x, UINT32_MAX));
+            }
+            return std::uint32_t(v) * 2654435761u;  // 頂点番号の乗算ハッシュ
+        };
+#pragma omp parallel for
+        for (count_t i = 0; i < m; i++) { index_t v = active[i]; atomic_store(&pivot[color[v]], key_t(UINT64_MAX)); fw[v] = bw[v] = 0; }
+#pragma omp parallel for
+        for (count_t i = 0; i < m; i++) {
+            index_t v = active[i];
+            write_min(&pivot[color[v]], (key_t(priority(v)) << 32) | std::uint32_t(v));
+        }
+        nf = 0;
+        for (auto v : active) { if (index_t(std::uint32_t(pivot[color[v]])) == v) { front[nf++] = v; } }
+
+        // すべての軸から、同じ色の頂点だけをたどって前向きと後ろ向きに探索する
+        count_t np = nf;
+        indices_t pivots(front.begin(), front.begin() + np);
+        for (auto p : pivots) { fw[p] = 1; }
+        sweep(np, [&](index_t u, auto push) {
+            forward(u, [&](index_t w) {
+                if (comp[w] == graph::nil && color[w] == color[u] && atomic_load(&fw[w]) == 0 &&
+                    cas(&fw[w], std::uint8_t(0), std::uint8_t(1))) { push(w); }
+            });
+        });
+        std::copy(pivots.begin(), pivots.end(), front.begin());
+        for (auto p : pivots) { bw[p] = 1; }
+        sweep(np, [&](index_t u, auto push) {
+            backward(u, [&](index_t w) {
+                if (comp[w] == graph::nil && color[w] == color[u] && atomic_load(&bw[w]) == 0 &&
+                    cas(&bw[w], std::uint8_t(0), std::uint8_t(1))) { push(w); }
+            });
+        });
+
+        // F ∩ Bを軸の成分とし、残りの頂点をF \ B, B \ F, V \ (F ∪ B)に分けて、それぞれに属する最小の頂点を新しい色とする
+#pragma omp parallel for
+        for (count_t i = 0; i < m; i++) {
+            index_t v = active[i];
+            group[v] = key_t(color[v]) * 3 + (fw[v] ? 1 : bw[v] ? 2 : 0);
+            atomic_store(&rep[group[v]], index_t(n));  // 同じ色の頂点が同じ要素に書き込むので、不可分に書き込む
+        }
+#pragma omp parallel for
+        for (count_t i = 0; i < m; i++) {
+            index_t v = active[i];
+            if (fw[v] && bw[v]) { comp[v] = index_t(std::uint32_t(pivot[color[v]])); continue; }
+            write_min(&rep[group[v]], v);
+        }
+#pragma omp parallel for
+        for (count_t i = 0; i < m; i++) {
+            index_t v = active[i];
+            if (comp[v] == graph::nil) { color[v] = rep[group[v]]; }
+        }
+        active.erase(std::remove_if(active.begin(), active.end(), [&](index_t v) { return comp[v] != graph::nil; }),
+                     active.end());
+    }
 
+    // 各成分に属する最小の頂点の順に番号を付け直す
+    indices_t id(n, graph::nil); index_t k = 0;
+    for (index_t v = 0; v < n; v++) {
+        if (id[comp[v]] == graph::nil) { id[comp[v]] = k++; }
+        comp[v] = id[comp[v]];
+    }
+    return comp;
+}
 
 
 #endif  // end of __SCC_HPP__
@@ -11,7 +11,9 @@
 //****************************************
 
 #include <iostream>
+#include <random>
 #include "tsort.hpp"
+#include "../Graph/csr.hpp"
 
 
 
@@ -56,4 +58,39 @@ int main(void)
         std::cout << name[lst[i]] << " ";
     }
     std::cout << std::endl;
+
+    // CSR表現に変換しても同じ順序が得られる
+    array_t csrlst = tsort(csrgraph(G));
+    for (int i = 0; i < vs; i++) {
+        std::cout << name[csrlst[i]] << " ";
+    }
+    std::cout << std::endl;
+
+    // 水準ごとに出力する(同じ水準の衣服は互いに依存しないので、どの順に着てもよい)
+    wavefronts W = leveltsort(G);
+    for (std::size_t k = 0; k < W.size(); k++) {
+        std::cout << k << " : ";
+        for (offset_t i = W.begin(k); i < W.end(k); i++) { std::cout << name[W.order[i]] << " "; }
+        std::cout << std::endl;
+    }
+
+    // 長さ10^6の道と、各頂点からランダムに先の頂点へ辺を張った有向非巡回グラフ
+    const index_t ps = 1000000;
+    graph_t P(ps);
+    std::mt19937 mt(1);
+    for (index_t u = 0; u + 1 < ps; u++) {
+        P[u].emplace_back(u, u + 1);
+        std::uniform_int_distribution<index_t> dist(u + 1, ps - 1);
+        for (int i = 0; i < 3; i++) { P[u].emplace_back(u, dist(mt)); }
+    }
+    W = leveltsort(csrgraph(P));
+    bool ok = W.order.size() == std::size_t(ps);
+    indices_t level(ps);
+    for (std::size_t k = 0; k < W.size(); k++) { for (offset_t i = W.begin(k); i < W.end(k); i++) { level[W.order[i]] = k; } }
+    for (index_t u = 0; ok && u < ps; u++) { for (auto& e : P[u]) { ok = ok && level[u] < level[e.dst]; } }
+    std::cout << W.size() << " levels " << (ok ? "ok" : "ng") << std::endl;
+
+    // 閉路を含むグラフでは、閉路上の頂点と閉路から到達できる頂点が含まれない
+    G[8].emplace_back(8, 0);
+    std::cout << leveltsort(G).order.size() << std::endl;
 }
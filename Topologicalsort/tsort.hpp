@@ -19,13 +19,48 @@
 // 必要なヘッダファイルのインクルード
 //****************************************
 
+#include <algorithm>
+#include <vector>
 #include "../Graph/graph.hpp"
+#include "../Graph/atomic.hpp"
+#include "../Graph/csr.hpp"
 
 
 
 
 //****************************************
-// 関数プロトタイプ
+// 構造体の定義
+//****************************************
+
+/**
+ * @brief  有向非巡回グラフの頂点の水準(level)への分割
+ *
+ * @note   頂点vの水準は、入次数0の頂点からvへの最長路の辺数である. 辺(u, v)があればuの水準はvの水準より小さいので、
+ *         水準の順に頂点を並べたものはトポロジカルソートであり、同じ水準の頂点の間には依存関係がない
+ *         従って、水準ごとに(wavefront)、その水準の頂点を並列に処理できる
+ *
+ * @note   水準kの頂点はorder[offsets[k]..offsets[k+1]-1]に頂点番号の昇順で格納する(CSR形式と同じ)
+ */
+struct wavefronts {
+    indices_t order;    /**< 水準の順に並べた頂点 */
+    offsets_t offsets;  /**< 各水準の開始位置 */
+
+    wavefronts() : offsets(1, 0) {}
+
+    /**< @brief 水準の数を返す */
+    std::size_t size() const { return offsets.size() - 1; }
+
+    /**< @brief 水準kの最初の頂点の位置を返す */
+    offset_t begin(std::size_t k) const { return offsets[k]; }
+
+    /**< @brief 水準kの最後の頂点の次の位置を返す */
+    offset_t end(std::size_t k) const { return offsets[k + 1]; }
+};
+
+
+
+//****************************************
+// 関数の定義
 //****************************************
 
 /**
@@ -34,10 +69,108 @@
  * @note   有向非巡回グラフG = (V, E)のトポロジカルソート(topological sort)は頂点集合上の線形順序で、
  *         Gが辺(u, v)を含むならば、この線形順序でuがvより先に現れるものである. (グラフに巡回路があればこのような線形順序は存在しない)
  *         グラフのトポロジカルソートは、すべての有向辺が左から右へ向かう、水平線上での頂点の並べ方である
- * @param  const graph& G 有向非巡回グラフ
+ * @tparam Graph グラフの表現(graph_tまたはcsrgraph)
+ * @param  const Graph& G 有向非巡回グラフ
  * @return 既ソートリスト
  */
-array_t tsort(const graph_t& G);
+template <class Graph>
+array_t tsort(const Graph& G)
+{
+    std::int32_t n = G.size();
+    std::vector<color> _color(n, color::white);
+    array_t lst; lst.reserve(n);
+
+    // 白節点uを訪れる. 再帰の代わりに(頂点, 次に調べる辺の位置)の明示的なスタックを用いる
+    struct frame { index_t u; std::size_t i; };
+    std::vector<frame> P;
+    auto visit = [&](index_t u) {
+        _color[u] = color::gray;   // uを灰に彩色する
+        P.push_back(frame{ u, 0 });
+        while (!P.empty()) {
+            frame& f = P.back();
+            const auto& adj = G[f.u];
+            if (f.i < adj.size()) {  // uと隣接する各頂点wを調べ、
+                index_t w = adj[f.i++].dst;
+                if (_color[w] == color::white) {  // wが白ならwを調べる
+                    _color[w] = color::gray; P.push_back(frame{ w, 0 });
+                }
+                continue;
+            }
+            _color[f.u] = color::black;  // uを黒に彩色する
+            lst.push_back(f.u);          // リストの末尾に挿入する
+            P.pop_back();
+        }
+    };
+
+
+    // 各頂点vの終了時刻v.fを計算するためにDFS(G)を呼び出す
+    for (index_t v = 0; v < n; v++) {
+        if (_color[v] == color::white) { visit(v); }
+    }
+    std::reverse(lst.begin(), lst.end());  // リストが逆順にソートされているのでreverseを行う
+    return lst;     // 頂点のリストを返す
+}
+
+
+/**
+ * @brief  Kahnのアルゴリズムによって、有向非巡回グラフの頂点を水準に分割する(マルチスレッド版)
+ *
+ * @note   入次数0の頂点の集合を水準0とする. 水準kの頂点から出る辺をすべて取り除いたとき、入次数が0になった頂点の集合が水準k + 1である
+ *         各頂点の残りの入次数を不可分な減算で数え、最後の入辺を取り除いたストランドだけがその頂点を次の水準に加える
+ *         1つの水準の中では頂点を並列に処理し、水準の間で同期する. 仕事量はΘ(V + E)であり、スパンは水準の数に比例する
+ *         再帰を用いないので、深さの大きいグラフでも呼び出しスタックが溢れることはない
+ *
+ * @note   Gが閉路を含む場合、閉路上の頂点と閉路から到達できる頂点は入次数が0にならず、どの水準にも含まれない
+ *         すなわち、Gが有向非巡回グラフであることと、order.size() == |V|であることは等価である
+ *
+ * @tparam Graph グラフの表現(graph_tまたはcsrgraph)
+ * @param  const Graph& G 有向非巡回グラフ
+ * @return 水準への分割
+ */
+template <class Graph>
+wavefronts leveltsort(const Graph& G)
+{
+    using count_t = std::int64_t;
+    std::int32_t n = G.size();
+    indices_t  indeg(n, 0);  // 各頂点の残りの入次数
+    wavefronts W;
+    W.order.resize(n);
+
+#pragma omp parallel for schedule(dynamic, 256)
+    for (index_t u = 0; u < n; u++) {
+        for (const auto& e : G[u]) { fetch_add(&indeg[e.dst], 1); }
+    }
+
+    // orderの末尾order[last..]に頂点を追記する. push(i, f)はi番目の候補を調べ、f(v)によって頂点vを追記する
+    count_t last = 0;
+    auto append = [&](count_t size, auto push) {
+#pragma omp parallel
+        {
+            indices_t local;
+#pragma omp for schedule(dynamic, 256) nowait
+            for (count_t i = 0; i < size; i++) { push(i, [&local](index_t v) { local.push_back(v); }); }
+            count_t i = fetch_add(&last, count_t(local.size()));
+            std::copy(local.begin(), local.end(), W.order.begin() + i);
+        }
+    };
+
+    // 水準0 : 入次数0の頂点
+    append(n, [&](count_t v, auto f) { if (indeg[v] == 0) { f(index_t(v)); } });
+    for (count_t first = 0; first < last; ) {
+        count_t k = W.size();
+        std::sort(W.order.begin() + first, W.order.begin() + last);  // 結果をスレッドの数によらず決定的にする
+        W.offsets.push_back(last);
+        // 水準kの頂点から出る辺を取り除き、入次数が0になった頂点を水準k + 1とする
+        first = last;
+        append(W.end(k) - W.begin(k), [&](count_t i, auto f) {
+            for (const auto& e : G[W.order[W.begin(k) + i]]) {
+                if (fetch_add(&indeg[e.dst], -1) == 1) { f(e.dst); }
+            }
+        });
+    }
+    W.order.resize(last);
+    return W;
+}
 
 
 
@@ -0,0 +1,77 @@
+/**
+ * @brief  ビット行列による三角形の数え上げと幅優先探索の動作確認
+ * @date   2026/10/15
+ */
+
+
+
+//****************************************
+// 必要なヘッダファイルのインクルード
+//****************************************
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include "triangles.hpp"
+#include "../Graph/csr.hpp"
+#include "../BFS/bfs.hpp"
+
+
+
+int main(void)
+{
+    using namespace std;
+
+    // 頂点数n、辺の密度pの無向ランダムグラフ
+    const std::int32_t n = 4000;
+    const double p = 0.05;
+    mt19937 mt(1);
+    uniform_real_distribution<double> coin(0.0, 1.0);
+    bitmatrix A(n);
+    edges_t   E;
+    for (index_t u = 0; u < n; u++) {
+        for (index_t v = u + 1; v < n; v++) {
+            if (coin(mt) < p) { A.set(u, v); A.set(v, u); E.emplace_back(u, v); E.emplace_back(v, u); }
+        }
+    }
+    csrgraph G(n, E);
+    cout << "n = " << n << ", m = " << E.size() << endl;
+    cout << "bitmatrix: " << A.words.size() * sizeof(bitmatrix::word_t) / 1024 << " KiB, "
+         << "matrix_t: "  << std::size_t(n) * n * sizeof(weight_t) / 1024 << " KiB" << endl;
+
+    // 隣接リストを用いた数え上げ(各辺(u, v), u < vについて、整列した隣接リストの共通部分のうちvより大きい頂点を数える)と比較する
+    auto t0 = chrono::steady_clock::now();
+    std::int64_t fast = triangles(A);
+    auto t1 = chrono::steady_clock::now();
+    std::int64_t slow = 0;
+    for (index_t u = 0; u < n; u++) {
+        for (const auto& e : G[u]) {
+            index_t v = e.dst;
+            if (v <= u) { continue; }
+            const index_t* a = G.targets.data() + G.offsets[u]; const index_t* ae = G.targets.data() + G.offsets[u + 1];
+            const index_t* b = G.targets.data() + G.offsets[v]; const index_t* be = G.targets.data() + G.offsets[v + 1];
+            while (a != ae && b != be) {
+                if      (*a < *b) { ++a; }
+                else if (*b < *a) { ++b; }
+                else              { slow += *a > v; ++a; ++b; }
+            }
+        }
+    }
+    auto t2 = chrono::steady_clock::now();
+    cout << "triangles: " << fast << " (bitmatrix " << chrono::duration<double, milli>(t1 - t0).count() << " ms), "
+         << slow << " (merge " << chrono::duration<double, milli>(t2 - t1).count() << " ms)" << endl;
+
+    // ビット行列上の幅優先探索は隣接リスト上の幅優先探索と同じ幅優先木を与える
+    auto t3 = chrono::steady_clock::now();
+    vertices_t X = bfs(A, 0);
+    auto t4 = chrono::steady_clock::now();
+    vertices_t Y = bfs(G, 0);
+    auto t5 = chrono::steady_clock::now();
+    bool ok = fast == slow;
+    for (index_t v = 0; v < n; v++) { ok = ok && X[v].d == Y[v].d && X[v].pi == Y[v].pi; }
+    cout << "bfs: bitmatrix " << chrono::duration<double, milli>(t4 - t3).count() << " ms, "
+         << "csr " << chrono::duration<double, milli>(t5 - t4).count() << " ms" << endl;
+    cout << (ok ? "ok" : "ng") << endl;
+    return 0;
+}